@@ -0,0 +1,80 @@
+#include <cstdio>
+#include <ctime>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "argparsor.h"
+
+/**
+ * @brief Compare conversion of an infinite option of integers with a vector of string and a stringstream by value
+ *        and with as<std::vector<int> > in one or all processors
+ */
+
+static const std::size_t NB_ID = 50000;
+static const std::size_t NB_LOOP = 20;
+
+static double microPerConversion(clock_t start, clock_t end) {
+    return static_cast<double>(end - start) / CLOCKS_PER_SEC * 1e6 / NB_LOOP;
+}
+
+int main() {
+    std::vector<std::string> ids;
+    ids.reserve(NB_ID);
+    for (std::size_t i = 0 ; i < NB_ID ; ++i) {
+        char buffer[32];
+        ::snprintf(buffer, sizeof(buffer), "%u", static_cast<unsigned int>(i * 2654435761u % 100000000u));
+        ids.push_back(buffer);
+    }
+    std::vector<char*> argv;
+    argv.push_back(const_cast<char*>("binaryname"));
+    argv.push_back(const_cast<char*>("--ids"));
+    for (std::size_t i = 0 ; i < NB_ID ; ++i) {
+        argv.push_back(const_cast<char*>(ids[i].c_str()));
+    }
+    mblet::Argparsor argparsor;
+    argparsor.setZeroCopy(true);
+    argparsor.addArgument("--ids", NULL, NULL, false, NULL, '+');
+    argparsor.parseArguments(argv.size(), &argv[0]);
+
+    long check = 0;
+    clock_t start = ::clock();
+    for (std::size_t loop = 0 ; loop < NB_LOOP ; ++loop) {
+        std::vector<std::string> strIds = argparsor["--ids"];
+        std::vector<int> intIds;
+        for (std::size_t i = 0 ; i < strIds.size() ; ++i) {
+            std::stringstream stringStream(strIds[i]);
+            int id;
+            stringStream >> id;
+            intIds.push_back(id);
+        }
+        check += intIds.back();
+    }
+    clock_t streamEnd = ::clock();
+    for (std::size_t loop = 0 ; loop < NB_LOOP ; ++loop) {
+        std::vector<int> intIds = argparsor["--ids"].as<std::vector<int> >();
+        check -= intIds.back();
+    }
+    clock_t asEnd = ::clock();
+    // clock() is the cpu time of all threads
+    timeval parallelStart;
+    ::gettimeofday(&parallelStart, NULL);
+    for (std::size_t loop = 0 ; loop < NB_LOOP ; ++loop) {
+        std::vector<int> intIds;
+        argparsor["--ids"].as(&intIds, 0);
+        check += intIds.back();
+    }
+    timeval parallelEnd;
+    ::gettimeofday(&parallelEnd, NULL);
+    double parallelMicro = ((parallelEnd.tv_sec - parallelStart.tv_sec) * 1e6
+                            + (parallelEnd.tv_usec - parallelStart.tv_usec)) / NB_LOOP;
+
+    ::printf("%lu ids: vector of string + stringstream %9.2f us, as<std::vector<int> > %9.2f us, "
+             "in %ld threads %9.2f us (%ld)\n",
+             static_cast<unsigned long>(NB_ID), microPerConversion(start, streamEnd),
+             microPerConversion(streamEnd, asEnd), ::sysconf(_SC_NPROCESSORS_ONLN), parallelMicro, check);
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "argparsor.h"
+
+/**
+ * @brief Compare a configuration file read by std::getline and given in argv with the configuration file of parse
+ */
+
+static const std::size_t NB_PARSE = 2000;
+
+static double microPerParse(clock_t start, clock_t end) {
+    return static_cast<double>(end - start) / CLOCKS_PER_SEC * 1e6 / NB_PARSE;
+}
+
+static void bench(std::size_t nbOption) {
+    const char* filename = "/tmp/argparsor_configFile.ini";
+    std::ofstream ofs(filename);
+    mblet::Argparsor argparsor;
+    for (std::size_t i = 0 ; i < nbOption ; ++i) {
+        char flag[32];
+        ::snprintf(flag, sizeof(flag), "--option-number-%lu", static_cast<unsigned long>(i));
+        argparsor.addArgument(flag, NULL, NULL, false, NULL, 1, 1, "default");
+        ofs << (flag + 2) << " = value of option " << i << '\n';
+    }
+    ofs.close();
+    const char* argv[] = {
+        "binaryname"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor::Result result;
+
+    std::size_t check = 0;
+    clock_t start = ::clock();
+    for (std::size_t i = 0 ; i < NB_PARSE ; ++i) {
+        // copy of lines, of keys and of values before the parse
+        std::vector<std::string> arguments(1, "binaryname");
+        std::ifstream ifs(filename);
+        std::string line;
+        while (std::getline(ifs, line)) {
+            std::size_t equal = line.find(" = ");
+            arguments.push_back("--" + line.substr(0, equal));
+            arguments.push_back(line.substr(equal + 3));
+        }
+        std::vector<char*> arguments2;
+        for (std::size_t j = 0 ; j < arguments.size() ; ++j) {
+            arguments2.push_back(const_cast<char*>(arguments[j].c_str()));
+        }
+        argparsor.parse(static_cast<int>(arguments2.size()), &arguments2[0], &result);
+        check += result["--option-number-0"].count();
+    }
+    clock_t getlineEnd = ::clock();
+    argparsor.setConfigFile(filename);
+    for (std::size_t i = 0 ; i < NB_PARSE ; ++i) {
+        argparsor.parse(argc, const_cast<char**>(argv), &result);
+        check += result["--option-number-0"].count();
+    }
+    clock_t configEnd = ::clock();
+    argparsor.setZeroCopy(true);
+    for (std::size_t i = 0 ; i < NB_PARSE ; ++i) {
+        argparsor.parse(argc, const_cast<char**>(argv), &result);
+        check += result["--option-number-0"].count();
+    }
+    clock_t zeroCopyEnd = ::clock();
+    ::remove(filename);
+
+    ::printf("%4lu options: getline %8.2f us, config file %8.2f us, config file zero copy %8.2f us (%lu)\n",
+             static_cast<unsigned long>(nbOption), microPerParse(start, getlineEnd),
+             microPerParse(getlineEnd, configEnd), microPerParse(configEnd, zeroCopyEnd),
+             static_cast<unsigned long>(check));
+}
+
+int main() {
+    bench(10);
+    bench(100);
+    bench(1000);
+    return 0;
+}
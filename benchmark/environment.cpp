@@ -0,0 +1,73 @@
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "argparsor.h"
+
+/**
+ * @brief Compare the fallback of options on environment with a getenv by option and with the parse
+ */
+
+static const std::size_t NB_PARSE = 2000;
+
+static double microPerParse(clock_t start, clock_t end) {
+    return static_cast<double>(end - start) / CLOCKS_PER_SEC * 1e6 / NB_PARSE;
+}
+
+static void bench(std::size_t nbOption, std::size_t nbVariable) {
+    // environment of CI
+    for (std::size_t i = 0 ; i < nbVariable ; ++i) {
+        char name[32];
+        ::snprintf(name, sizeof(name), "CI_VARIABLE_%lu", static_cast<unsigned long>(i));
+        ::setenv(name, "value of variable", 1);
+    }
+    mblet::Argparsor argparsor;
+    std::vector<std::string> variables;
+    for (std::size_t i = 0 ; i < nbOption ; ++i) {
+        char flag[32];
+        char variable[32];
+        ::snprintf(flag, sizeof(flag), "--option-number-%lu", static_cast<unsigned long>(i));
+        ::snprintf(variable, sizeof(variable), "APP_OPTION_%lu", static_cast<unsigned long>(i));
+        argparsor.addArgument(flag, NULL, NULL, false, NULL, 1, 1, "default");
+        argparsor.setEnvironmentVariable(flag, variable);
+        variables.push_back(variable);
+        // one option of ten is in environment
+        if (i % 10 == 0) {
+            ::setenv(variable, "42", 1);
+        }
+    }
+    const char* argv[] = {
+        "binaryname"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+
+    std::size_t check = 0;
+    clock_t start = ::clock();
+    for (std::size_t i = 0 ; i < NB_PARSE ; ++i) {
+        for (std::size_t j = 0 ; j < variables.size() ; ++j) {
+            if (::getenv(variables[j].c_str()) != NULL) {
+                ++check;
+            }
+        }
+    }
+    clock_t getenvEnd = ::clock();
+    mblet::Argparsor::Result result;
+    for (std::size_t i = 0 ; i < NB_PARSE ; ++i) {
+        argparsor.parse(argc, const_cast<char**>(argv), &result);
+        check += result["--option-number-0"].count();
+    }
+    clock_t parseEnd = ::clock();
+
+    ::printf("%4lu options, %4lu variables: getenv %8.2f us, parse with one pass %8.2f us (%lu)\n",
+             static_cast<unsigned long>(nbOption), static_cast<unsigned long>(nbVariable),
+             microPerParse(start, getenvEnd), microPerParse(getenvEnd, parseEnd), static_cast<unsigned long>(check));
+}
+
+int main() {
+    bench(10, 100);
+    bench(100, 500);
+    bench(500, 2000);
+    return 0;
+}
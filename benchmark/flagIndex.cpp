@@ -0,0 +1,54 @@
+#include <cstdio>
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "argparsor.h"
+
+/**
+ * @brief Compare lookup of flag name with std::map and Argparsor index
+ */
+
+static const std::size_t NB_LOOKUP = 2000000;
+
+static double nanoPerLookup(clock_t start, clock_t end) {
+    return static_cast<double>(end - start) / CLOCKS_PER_SEC * 1e9 / NB_LOOKUP;
+}
+
+static void bench(std::size_t nbFlag) {
+    mblet::Argparsor argparsor;
+    std::map<std::string, const mblet::Argparsor::Argument*> map;
+    std::vector<std::string> names;
+    for (std::size_t i = 0 ; i < nbFlag ; ++i) {
+        char buffer[32];
+        ::snprintf(buffer, sizeof(buffer), "--option-number-%lu", static_cast<unsigned long>(i));
+        names.push_back(buffer);
+        argparsor.addArgument(buffer, "store_true");
+        map.insert(std::make_pair(names.back(), &argparsor[buffer]));
+    }
+
+    std::size_t check = 0;
+    clock_t start = ::clock();
+    for (std::size_t i = 0 ; i < NB_LOOKUP ; ++i) {
+        const std::string& name = names[i % nbFlag];
+        check += map.find(name)->second->count();
+    }
+    clock_t mapEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_LOOKUP ; ++i) {
+        const std::string& name = names[i % nbFlag];
+        check += argparsor.getOption(name).count();
+    }
+    clock_t indexEnd = ::clock();
+
+    ::printf("%5lu flags: std::map %7.2f ns/lookup, index %7.2f ns/lookup (%lu)\n",
+             static_cast<unsigned long>(nbFlag), nanoPerLookup(start, mapEnd), nanoPerLookup(mapEnd, indexEnd),
+             static_cast<unsigned long>(check));
+}
+
+int main() {
+    bench(10);
+    bench(100);
+    bench(1000);
+    return 0;
+}
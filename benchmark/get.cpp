@@ -0,0 +1,52 @@
+#include <cstdio>
+#include <ctime>
+
+#include "argparsor.h"
+
+/**
+ * @brief Compare repeated reads of an option with strto of str(), as<int>() and get<int>()
+ *        (by lookup and by reference)
+ */
+
+static const std::size_t NB_READ = 2000000;
+
+static double nanoPerRead(clock_t start, clock_t end) {
+    return static_cast<double>(end - start) / CLOCKS_PER_SEC * 1e9 / NB_READ;
+}
+
+int main() {
+    const char* argv[] = {
+        "binaryname",
+        "--threads", "16"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("--threads", NULL, NULL, false, NULL, 1);
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+
+    long check = 0;
+    clock_t start = ::clock();
+    for (std::size_t i = 0 ; i < NB_READ ; ++i) {
+        check += mblet::strto<int>(argparsor["--threads"].str());
+    }
+    clock_t strEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_READ ; ++i) {
+        check += argparsor["--threads"].as<int>();
+    }
+    clock_t asEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_READ ; ++i) {
+        check += argparsor["--threads"].get<int>();
+    }
+    clock_t getEnd = ::clock();
+    const mblet::Argparsor::Argument& threads = argparsor["--threads"];
+    for (std::size_t i = 0 ; i < NB_READ ; ++i) {
+        check += threads.get<int>();
+    }
+    clock_t referenceEnd = ::clock();
+
+    ::printf("strto<int>(str()) %7.2f ns/read, as<int>() %7.2f ns/read, get<int>() %7.2f ns/read, "
+             "get<int>() of reference %7.2f ns/read (%ld)\n",
+             nanoPerRead(start, strEnd), nanoPerRead(strEnd, asEnd), nanoPerRead(asEnd, getEnd),
+             nanoPerRead(getEnd, referenceEnd), check);
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include <cstdio>
+#include <ctime>
+#include <sstream>
+
+#include "argparsor.h"
+
+/**
+ * @brief Compare getUsage with a render at each call (cache invalidated by setEpilog) and with the cached render
+ */
+
+static const std::size_t NB_USAGE = 20000;
+
+static double microPerUsage(clock_t start, clock_t end) {
+    return static_cast<double>(end - start) / CLOCKS_PER_SEC * 1e6 / NB_USAGE;
+}
+
+int main() {
+    mblet::Argparsor argparsor;
+    argparsor.setDescription("description of binary");
+    for (std::size_t i = 0 ; i < 30 ; ++i) {
+        char buffer[32];
+        ::snprintf(buffer, sizeof(buffer), "--option-number-%lu", static_cast<unsigned long>(i));
+        argparsor.addArgument(buffer, NULL, "help of option", false, NULL, 1, 1, "default");
+    }
+
+    std::size_t check = 0;
+    clock_t start = ::clock();
+    for (std::size_t i = 0 ; i < NB_USAGE ; ++i) {
+        argparsor.setEpilog("epilog of binary");
+        std::ostringstream oss("");
+        argparsor.getUsage(oss);
+        check += oss.str().size();
+    }
+    clock_t renderEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_USAGE ; ++i) {
+        std::ostringstream oss("");
+        argparsor.getUsage(oss);
+        check -= oss.str().size();
+    }
+    clock_t cacheEnd = ::clock();
+
+    ::printf("render %8.2f us/usage, cached %8.2f us/usage (%lu)\n",
+             microPerUsage(start, renderEnd), microPerUsage(renderEnd, cacheEnd), static_cast<unsigned long>(check));
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+
+#include "argparsor.h"
+
+/**
+ * @brief Compare the write of usage in /dev/null with a std::ofstream and with a file descriptor
+ */
+
+static const std::size_t NB_USAGE = 100000;
+
+static double microPerUsage(clock_t start, clock_t end) {
+    return static_cast<double>(end - start) / CLOCKS_PER_SEC * 1e6 / NB_USAGE;
+}
+
+int main() {
+    mblet::Argparsor argparsor;
+    argparsor.setDescription("description of binary");
+    for (std::size_t i = 0 ; i < 30 ; ++i) {
+        char buffer[32];
+        ::snprintf(buffer, sizeof(buffer), "--option-number-%lu", static_cast<unsigned long>(i));
+        argparsor.addArgument(buffer, NULL, "help of option", false, NULL, 1, 1, "default");
+    }
+    std::ofstream ofs("/dev/null");
+    int fd = ::open("/dev/null", O_WRONLY);
+    if (!ofs.is_open() || fd < 0) {
+        ::fprintf(stderr, "cannot open /dev/null\n");
+        return 1;
+    }
+
+    clock_t start = ::clock();
+    for (std::size_t i = 0 ; i < NB_USAGE ; ++i) {
+        argparsor.getUsage(ofs);
+        ofs.flush();
+    }
+    clock_t streamEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_USAGE ; ++i) {
+        argparsor.getUsage(fd);
+    }
+    clock_t fdEnd = ::clock();
+    ::close(fd);
+
+    ::printf("std::ofstream %6.2f us/usage, fd %6.2f us/usage\n",
+             microPerUsage(start, streamEnd), microPerUsage(streamEnd, fdEnd));
+    return 0;
+}
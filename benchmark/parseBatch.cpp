@@ -0,0 +1,47 @@
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include "argparsor.h"
+
+/**
+ * @brief Compare parseBatch of many command lines with one thread and with all processors
+ */
+
+static const std::size_t NB_LINE = 200000;
+
+static double now() {
+    struct timeval tv;
+    ::gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+int main() {
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-v --verbose", "store_true", "verbose");
+    argparsor.addArgument("-o --output", NULL, "output file", false, "FILE", 1, 1, "a.out");
+    argparsor.addArgument("-j --jobs", NULL, "number of jobs", false, "N", 1, 1, "1");
+    argparsor.addArgument("-D --define", "append", "define", false, "MACRO", 1);
+    argparsor.addArgument("INPUT", NULL, "input file", true);
+
+    std::ostringstream oss("");
+    for (std::size_t i = 0 ; i < NB_LINE ; ++i) {
+        oss << "binaryname -v --output result" << i << ".txt -j 8 --define=A -D B input" << i << ".txt\n";
+    }
+    const std::string buffer = oss.str();
+
+    long nbProcessor = ::sysconf(_SC_NPROCESSORS_ONLN);
+    mblet::Argparsor::Batch batch;
+    double start = now();
+    argparsor.parseBatch(buffer.c_str(), buffer.size(), &batch, false, false, 1);
+    double oneEnd = now();
+    argparsor.parseBatch(buffer.c_str(), buffer.size(), &batch);
+    double allEnd = now();
+
+    ::printf("%lu lines: 1 thread %7.2f ms, %ld threads %7.2f ms\n", static_cast<unsigned long>(NB_LINE),
+             (oneEnd - start) * 1e3, nbProcessor, (allEnd - oneEnd) * 1e3);
+    return 0;
+}
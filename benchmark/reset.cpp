@@ -0,0 +1,59 @@
+#include <cstdio>
+#include <ctime>
+
+#include "argparsor.h"
+
+/**
+ * @brief Compare parse of many command lines with a rebuild or a reset of Argparsor
+ */
+
+static const std::size_t NB_PARSE = 200000;
+
+static const char* s_argv[] = {
+    "binaryname",
+    "--include", "/usr/include", "/opt/include", "-v", "--output", "result.txt", "-j", "8", "--define=A", "-D", "B",
+    "input.txt", "extra1", "extra2"
+};
+static const int s_argc = sizeof(s_argv) / sizeof(*s_argv);
+
+static double nanoPerParse(clock_t start, clock_t end) {
+    return static_cast<double>(end - start) / CLOCKS_PER_SEC * 1e9 / NB_PARSE;
+}
+
+static void addArguments(mblet::Argparsor& argparsor) {
+    argparsor.addArgument("-v --verbose", "store_true", "verbose");
+    argparsor.addArgument("-q --quiet", "store_true", "quiet");
+    argparsor.addArgument("-o --output", NULL, "output file", false, "FILE", 1, 1, "a.out");
+    argparsor.addArgument("-j --jobs", NULL, "number of jobs", false, "N", 1, 1, "1");
+    argparsor.addArgument("-D --define", "append", "define", false, "MACRO", 1);
+    argparsor.addArgument("-I --include", "extend", "include directories", false, "DIR", '+');
+    argparsor.addArgument("-W --warning", "append", "warning", false, NULL, 1);
+    argparsor.addArgument("-O --optimize", NULL, "optimization level", false, "LEVEL", 1, 1, "0");
+    argparsor.addArgument("-g --debug", "store_true", "debug");
+    argparsor.addArgument("-s --size", NULL, "size", false, NULL, 2, 2, "640", "480");
+    argparsor.addArgument("INPUT", NULL, "input file", true);
+}
+
+int main() {
+    std::size_t check = 0;
+    clock_t start = ::clock();
+    for (std::size_t i = 0 ; i < NB_PARSE ; ++i) {
+        mblet::Argparsor argparsor;
+        addArguments(argparsor);
+        argparsor.parseArguments(s_argc, const_cast<char**>(s_argv));
+        check += argparsor["-D"].size();
+    }
+    clock_t rebuildEnd = ::clock();
+    mblet::Argparsor argparsor;
+    addArguments(argparsor);
+    for (std::size_t i = 0 ; i < NB_PARSE ; ++i) {
+        argparsor.reset();
+        argparsor.parseArguments(s_argc, const_cast<char**>(s_argv));
+        check += argparsor["-D"].size();
+    }
+    clock_t resetEnd = ::clock();
+
+    ::printf("rebuild %8.2f ns/parse, reset %8.2f ns/parse (%lu)\n",
+             nanoPerParse(start, rebuildEnd), nanoPerParse(rebuildEnd, resetEnd), static_cast<unsigned long>(check));
+    return 0;
+}
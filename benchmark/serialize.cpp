@@ -0,0 +1,74 @@
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "argparsor.h"
+
+/**
+ * @brief Compare dump with serialize in JSON and binary, and a parse with a deserialize
+ */
+
+static const std::size_t NB_LOOP = 20000;
+
+static double microPerLoop(clock_t start, clock_t end) {
+    return static_cast<double>(end - start) / CLOCKS_PER_SEC * 1e6 / NB_LOOP;
+}
+
+int main() {
+    mblet::Argparsor argparsor;
+    std::vector<std::string> arguments;
+    arguments.push_back("binaryname");
+    for (std::size_t i = 0 ; i < 50 ; ++i) {
+        char buffer[32];
+        ::snprintf(buffer, sizeof(buffer), "--option-number-%lu", static_cast<unsigned long>(i));
+        argparsor.addArgument(buffer, NULL, "help of option", false, NULL, 1, 1, "default");
+        arguments.push_back(buffer);
+        arguments.push_back("value of option");
+    }
+    std::vector<char*> argv;
+    for (std::size_t i = 0 ; i < arguments.size() ; ++i) {
+        argv.push_back(const_cast<char*>(arguments[i].c_str()));
+    }
+    argparsor.parseArguments(argv.size(), &argv[0]);
+    std::vector<char> json(argparsor.serialize(NULL, 0, mblet::Argparsor::JSON_FORMAT));
+    std::vector<char> binary(argparsor.serialize(NULL, 0, mblet::Argparsor::BINARY_FORMAT));
+
+    std::size_t check = 0;
+    clock_t start = ::clock();
+    for (std::size_t i = 0 ; i < NB_LOOP ; ++i) {
+        check += argparsor.dump().size();
+    }
+    clock_t dumpEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_LOOP ; ++i) {
+        check += argparsor.serialize(&json[0], json.size(), mblet::Argparsor::JSON_FORMAT);
+    }
+    clock_t jsonEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_LOOP ; ++i) {
+        check += argparsor.serialize(&binary[0], binary.size(), mblet::Argparsor::BINARY_FORMAT);
+    }
+    clock_t binaryEnd = ::clock();
+    ::printf("dump   %7.2f us, serialize json %7.2f us, binary %7.2f us (%lu)\n", microPerLoop(start, dumpEnd),
+             microPerLoop(dumpEnd, jsonEnd), microPerLoop(jsonEnd, binaryEnd), static_cast<unsigned long>(check));
+
+    mblet::Argparsor::Result result;
+    start = ::clock();
+    for (std::size_t i = 0 ; i < NB_LOOP ; ++i) {
+        argparsor.parse(argv.size(), &argv[0], &result);
+        check += result.getAdditionalArguments().size();
+    }
+    clock_t parseEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_LOOP ; ++i) {
+        argparsor.deserialize(&json[0], json.size(), &result);
+        check += result.getAdditionalArguments().size();
+    }
+    jsonEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_LOOP ; ++i) {
+        argparsor.deserialize(&binary[0], binary.size(), &result);
+        check += result.getAdditionalArguments().size();
+    }
+    binaryEnd = ::clock();
+    ::printf("parse  %7.2f us, deserialize json %7.2f us, binary %7.2f us (%lu)\n", microPerLoop(start, parseEnd),
+             microPerLoop(parseEnd, jsonEnd), microPerLoop(jsonEnd, binaryEnd), static_cast<unsigned long>(check));
+    return 0;
+}
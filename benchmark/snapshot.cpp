@@ -0,0 +1,123 @@
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "argparsor.h"
+
+/**
+ * @brief Compare the private memory of a forked worker which reads the arguments of Argparsor (get<T> keeps its
+ *        cache in the arguments) and of a Snapshot, and the time of lookups
+ */
+
+static const std::size_t NB_OPTION = 5000;
+static const std::size_t NB_LOOKUP = 1000000;
+
+/**
+ * @brief Get the private dirty memory of process in kB (0 if /proc is not available)
+ *
+ * @return long
+ */
+static long privateDirty() {
+    FILE* file = ::fopen("/proc/self/smaps_rollup", "r");
+    if (file == NULL) {
+        return 0;
+    }
+    char line[256];
+    long ret = 0;
+    while (::fgets(line, sizeof(line), file) != NULL) {
+        if (::strncmp(line, "Private_Dirty:", 14) == 0) {
+            ret = ::atol(line + 14);
+        }
+    }
+    ::fclose(file);
+    return ret;
+}
+
+static int getValue(const mblet::Argparsor& argparsor, const std::string& name) {
+    return argparsor[name].get<int>();
+}
+
+static int getValue(const mblet::Argparsor::Snapshot& snapshot, const std::string& name) {
+    return snapshot[name].as<int>();
+}
+
+template<typename T>
+static long workerDirty(const T& state, const std::vector<std::string>& names) {
+    int fds[2];
+    if (::pipe(fds) != 0) {
+        return -1;
+    }
+    pid_t pid = ::fork();
+    if (pid == 0) {
+        long start = privateDirty();
+        long check = 0;
+        for (std::size_t i = 0 ; i < names.size() ; ++i) {
+            check += getValue(state, names[i]);
+        }
+        long dirty = privateDirty() - start;
+        (void)check;
+        ssize_t ret = ::write(fds[1], &dirty, sizeof(dirty));
+        ::_exit((ret == sizeof(dirty)) ? 0 : 1);
+    }
+    ::close(fds[1]);
+    long dirty = -1;
+    if (::read(fds[0], &dirty, sizeof(dirty)) != sizeof(dirty)) {
+        dirty = -1;
+    }
+    ::close(fds[0]);
+    ::waitpid(pid, NULL, 0);
+    return dirty;
+}
+
+int main() {
+    mblet::Argparsor argparsor;
+    std::vector<std::string> arguments;
+    std::vector<std::string> names;
+    arguments.push_back("binaryname");
+    for (std::size_t i = 0 ; i < NB_OPTION ; ++i) {
+        char buffer[32];
+        ::snprintf(buffer, sizeof(buffer), "--option-number-%lu", static_cast<unsigned long>(i));
+        argparsor.addArgument(buffer, NULL, "help of option", false, NULL, 1);
+        names.push_back(buffer);
+        arguments.push_back(buffer);
+        ::snprintf(buffer, sizeof(buffer), "%lu", static_cast<unsigned long>(i));
+        arguments.push_back(buffer);
+    }
+    std::vector<char*> argv;
+    for (std::size_t i = 0 ; i < arguments.size() ; ++i) {
+        argv.push_back(const_cast<char*>(arguments[i].c_str()));
+    }
+    argparsor.parseArguments(argv.size(), &argv[0]);
+
+    clock_t start = ::clock();
+    mblet::Argparsor::Snapshot snapshot;
+    argparsor.snapshot(&snapshot);
+    clock_t snapshotEnd = ::clock();
+    ::printf("snapshot of %lu options: %.2f ms, %lu bytes\n", static_cast<unsigned long>(NB_OPTION),
+             static_cast<double>(snapshotEnd - start) / CLOCKS_PER_SEC * 1e3,
+             static_cast<unsigned long>(snapshot.size()));
+
+    ::printf("private memory of worker: Argparsor %ld kB, Snapshot %ld kB\n", workerDirty(argparsor, names),
+             workerDirty(snapshot, names));
+
+    std::size_t check = 0;
+    start = ::clock();
+    for (std::size_t i = 0 ; i < NB_LOOKUP ; ++i) {
+        check += argparsor[names[i % NB_OPTION]].count();
+    }
+    clock_t argparsorEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_LOOKUP ; ++i) {
+        check += snapshot[names[i % NB_OPTION]].count();
+    }
+    clock_t snapshotLookupEnd = ::clock();
+    ::printf("lookup: Argparsor %.2f ns, Snapshot %.2f ns (%lu)\n",
+             static_cast<double>(argparsorEnd - start) / CLOCKS_PER_SEC * 1e9 / NB_LOOKUP,
+             static_cast<double>(snapshotLookupEnd - argparsorEnd) / CLOCKS_PER_SEC * 1e9 / NB_LOOKUP,
+             static_cast<unsigned long>(check));
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+
+#include "argparsor.h"
+
+/**
+ * @brief Compare the write of an infinite option in a stream with a ostringstream by value (previous str())
+ *        and with write, and str() with ostringstream and with append
+ */
+
+static const std::size_t NB_LOOP = 200000;
+
+static double nanoPerLoop(clock_t start, clock_t end) {
+    return static_cast<double>(end - start) / CLOCKS_PER_SEC * 1e9 / NB_LOOP;
+}
+
+/**
+ * @brief Previous str(): values joined in a ostringstream
+ */
+static std::string streamStr(const mblet::Argparsor::Argument& argument) {
+    std::ostringstream oss("");
+    for (std::size_t i = 0 ; i < argument.size() ; ++i) {
+        if (i > 0) {
+            oss << ", ";
+        }
+        oss << argument[i];
+    }
+    return oss.str();
+}
+
+int main() {
+    const char* argv[] = {
+        "binaryname",
+        "--path", "/usr/local/lib", "/usr/lib", "/lib", "/opt/lib", "/home/user/.local/lib", "/srv/lib"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("--path", NULL, NULL, false, NULL, '+');
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    const mblet::Argparsor::Argument& path = argparsor["--path"];
+    std::ofstream devNull("/dev/null");
+
+    std::size_t check = 0;
+    clock_t start = ::clock();
+    for (std::size_t i = 0 ; i < NB_LOOP ; ++i) {
+        devNull << streamStr(path) << '\n';
+    }
+    clock_t streamEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_LOOP ; ++i) {
+        devNull << path << '\n';
+    }
+    clock_t writeEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_LOOP ; ++i) {
+        check += streamStr(path).size();
+    }
+    clock_t streamStrEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_LOOP ; ++i) {
+        check += path.str().size();
+    }
+    clock_t strEnd = ::clock();
+
+    ::printf("operator<<: ostringstream %7.2f ns, write %7.2f ns\n",
+             nanoPerLoop(start, streamEnd), nanoPerLoop(streamEnd, writeEnd));
+    ::printf("str():      ostringstream %7.2f ns, append %7.2f ns (%lu)\n",
+             nanoPerLoop(writeEnd, streamStrEnd), nanoPerLoop(streamStrEnd, strEnd), static_cast<unsigned long>(check));
+    return 0;
+}
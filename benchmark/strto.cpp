@@ -0,0 +1,188 @@
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "strto.h"
+
+/**
+ * @brief Compare conversion of integers and doubles with stringstream (previous strto) and strto
+ *        and conversion of bool with std::map (previous strto<bool>) and strto
+ */
+
+static const std::size_t NB_VALUE = 1000000;
+
+/**
+ * @brief Previous strto: check the digits, convert with strtoll/strtod and read the result with a stringstream
+ */
+template<typename T>
+static T streamStrto(const std::string& str) {
+    T ret;
+    std::stringstream stringStream("");
+    std::size_t index = 0;
+
+    if (str[index] == '-' || str[index] == '+') {
+        ++index;
+    }
+    if (str[index] == '0' && (str[index + 1] == 'x' || str[index + 1] == 'X')) {
+        stringStream << strtoll(str.c_str(), NULL, 16);
+    }
+    else if (str[index] == '0' && (str[index + 1] == 'b' || str[index + 1] == 'B')) {
+        stringStream << strtoull(str.c_str() + index + 2, NULL, 2);
+    }
+    else if (str[index] == '0' && str.find('.') == std::string::npos && str.find('e') == std::string::npos
+             && str.find('E') == std::string::npos) {
+        stringStream << strtoll(str.c_str(), NULL, 8);
+    }
+    else {
+        char* endPtr = NULL;
+        stringStream << strtod(str.c_str(), &endPtr);
+        if (endPtr != NULL && endPtr[0] != '\0') {
+            throw mblet::StrToException(str, "number");
+        }
+    }
+    if (stringStream >> ret) {
+        return ret;
+    }
+    else {
+        throw mblet::StrToException(str, "number");
+    }
+}
+
+/**
+ * @brief Previous strto<bool>: lookup in a map of spellings
+ */
+static bool mapStrtoBool(const std::string& str) {
+    static const std::pair<std::string, bool> pairStrToBool[] = {
+        std::pair<std::string, bool>("TRUE", true),
+        std::pair<std::string, bool>("True", true),
+        std::pair<std::string, bool>("true", true),
+        std::pair<std::string, bool>("ON", true),
+        std::pair<std::string, bool>("On", true),
+        std::pair<std::string, bool>("on", true),
+        std::pair<std::string, bool>("YES", true),
+        std::pair<std::string, bool>("Yes", true),
+        std::pair<std::string, bool>("yes", true),
+        std::pair<std::string, bool>("Y", true),
+        std::pair<std::string, bool>("y", true),
+        std::pair<std::string, bool>("1", true),
+        std::pair<std::string, bool>("FALSE", false),
+        std::pair<std::string, bool>("False", false),
+        std::pair<std::string, bool>("false", false),
+        std::pair<std::string, bool>("OFF", false),
+        std::pair<std::string, bool>("Off", false),
+        std::pair<std::string, bool>("off", false),
+        std::pair<std::string, bool>("NO", false),
+        std::pair<std::string, bool>("No", false),
+        std::pair<std::string, bool>("no", false),
+        std::pair<std::string, bool>("N", false),
+        std::pair<std::string, bool>("n", false),
+        std::pair<std::string, bool>("0", false)
+    };
+    static const std::map<std::string, bool> strToBool(pairStrToBool,
+                                                       pairStrToBool + sizeof(pairStrToBool) / sizeof(*pairStrToBool));
+
+    std::map<std::string, bool>::const_iterator cit = strToBool.find(str);
+    if (cit != strToBool.end()) {
+        return cit->second;
+    }
+    else {
+        throw mblet::StrToException(str, "bool");
+    }
+}
+
+static double nanoPerValue(clock_t start, clock_t end) {
+    return static_cast<double>(end - start) / CLOCKS_PER_SEC * 1e9 / NB_VALUE;
+}
+
+static void benchInteger(const char* name, const char* format) {
+    std::vector<std::string> values;
+    values.reserve(NB_VALUE);
+    for (std::size_t i = 0 ; i < NB_VALUE ; ++i) {
+        char buffer[32];
+        ::snprintf(buffer, sizeof(buffer), format, static_cast<unsigned int>(i * 2654435761u % 100000000u));
+        values.push_back(buffer);
+    }
+
+    long check = 0;
+    clock_t start = ::clock();
+    for (std::size_t i = 0 ; i < NB_VALUE ; ++i) {
+        check += streamStrto<int>(values[i]);
+    }
+    clock_t streamEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_VALUE ; ++i) {
+        check -= mblet::strto<int>(values[i]);
+    }
+    clock_t strtoEnd = ::clock();
+
+    ::printf("%-8s stringstream %7.2f ns/value, strto %7.2f ns/value (%ld)\n", name,
+             nanoPerValue(start, streamEnd), nanoPerValue(streamEnd, strtoEnd), check);
+}
+
+static void benchDouble(const char* name, const char* format) {
+    std::vector<std::string> values;
+    values.reserve(NB_VALUE);
+    for (std::size_t i = 0 ; i < NB_VALUE ; ++i) {
+        char buffer[32];
+        ::snprintf(buffer, sizeof(buffer), format, static_cast<double>(i * 2654435761u % 100000000u) / 4096.0);
+        values.push_back(buffer);
+    }
+
+    double check = 0;
+    std::size_t nbExact = 0;
+    clock_t start = ::clock();
+    for (std::size_t i = 0 ; i < NB_VALUE ; ++i) {
+        check += streamStrto<double>(values[i]);
+    }
+    clock_t streamEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_VALUE ; ++i) {
+        check -= mblet::strto<double>(values[i]);
+    }
+    clock_t strtoEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_VALUE ; ++i) {
+        nbExact += (mblet::strto<double>(values[i]) == ::strtod(values[i].c_str(), NULL));
+    }
+
+    ::printf("%-8s stringstream %7.2f ns/value, strto %7.2f ns/value (%g, exact %lu/%lu)\n", name,
+             nanoPerValue(start, streamEnd), nanoPerValue(streamEnd, strtoEnd), check,
+             static_cast<unsigned long>(nbExact), static_cast<unsigned long>(NB_VALUE));
+}
+
+static void benchBool() {
+    static const char* spellings[] = {
+        "TRUE", "True", "true", "ON", "On", "on", "YES", "Yes", "yes", "Y", "y", "1",
+        "FALSE", "False", "false", "OFF", "Off", "off", "NO", "No", "no", "N", "n", "0"
+    };
+    std::vector<std::string> values;
+    values.reserve(NB_VALUE);
+    for (std::size_t i = 0 ; i < NB_VALUE ; ++i) {
+        values.push_back(spellings[i * 2654435761u % (sizeof(spellings) / sizeof(*spellings))]);
+    }
+
+    long check = 0;
+    clock_t start = ::clock();
+    for (std::size_t i = 0 ; i < NB_VALUE ; ++i) {
+        check += mapStrtoBool(values[i]);
+    }
+    clock_t mapEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_VALUE ; ++i) {
+        check -= mblet::strto<bool>(values[i]);
+    }
+    clock_t strtoEnd = ::clock();
+
+    ::printf("%-8s std::map     %7.2f ns/value, strto %7.2f ns/value (%ld)\n", "bool",
+             nanoPerValue(start, mapEnd), nanoPerValue(mapEnd, strtoEnd), check);
+}
+
+int main() {
+    benchInteger("decimal", "%u");
+    benchInteger("hex", "0x%x");
+    benchInteger("octal", "0%o");
+    benchDouble("%.4f", "%.4f");
+    benchDouble("%.17g", "%.17g");
+    benchBool();
+    return 0;
+}
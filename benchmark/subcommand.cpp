@@ -0,0 +1,64 @@
+#include <cstdio>
+#include <ctime>
+
+#include "argparsor.h"
+
+/**
+ * @brief Compare the startup of a tool with all schemas of subcommands built and with the lazy subcommands
+ */
+
+static const std::size_t NB_RUN = 200;
+static const std::size_t NB_SUBCOMMAND = 150;
+static const std::size_t NB_OPTION = 30;
+
+static double microPerRun(clock_t start, clock_t end) {
+    return static_cast<double>(end - start) / CLOCKS_PER_SEC * 1e6 / NB_RUN;
+}
+
+static void buildSubcommand(mblet::Argparsor& argparsor, void* /*data*/) {
+    for (std::size_t i = 0 ; i < NB_OPTION ; ++i) {
+        char flag[32];
+        ::snprintf(flag, sizeof(flag), "--option-number-%lu", static_cast<unsigned long>(i));
+        argparsor.addArgument(flag, NULL, "help of option", false, NULL, 1, 1, "default");
+    }
+}
+
+int main() {
+    const char* argv[] = {
+        "binaryname",
+        "command-75", "--option-number-3", "value"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    char names[NB_SUBCOMMAND][32];
+    for (std::size_t i = 0 ; i < NB_SUBCOMMAND ; ++i) {
+        ::snprintf(names[i], sizeof(names[i]), "command-%lu", static_cast<unsigned long>(i));
+    }
+
+    std::size_t check = 0;
+    clock_t start = ::clock();
+    for (std::size_t i = 0 ; i < NB_RUN ; ++i) {
+        // all options of all subcommands
+        mblet::Argparsor* argparsors = new mblet::Argparsor[NB_SUBCOMMAND];
+        for (std::size_t j = 0 ; j < NB_SUBCOMMAND ; ++j) {
+            buildSubcommand(argparsors[j], NULL);
+        }
+        argparsors[75].parseArguments(argc - 1, const_cast<char**>(argv) + 1);
+        check += argparsors[75]["--option-number-3"].count();
+        delete[] argparsors;
+    }
+    clock_t eagerEnd = ::clock();
+    for (std::size_t i = 0 ; i < NB_RUN ; ++i) {
+        mblet::Argparsor argparsor;
+        for (std::size_t j = 0 ; j < NB_SUBCOMMAND ; ++j) {
+            argparsor.addSubcommand(names[j], &buildSubcommand, "help of subcommand");
+        }
+        argparsor.parseArguments(argc, const_cast<char**>(argv));
+        check += argparsor.getSubcommand()["--option-number-3"].count();
+    }
+    clock_t lazyEnd = ::clock();
+
+    ::printf("%lu subcommands of %lu options: all built %8.2f us, lazy %8.2f us (%lu)\n",
+             static_cast<unsigned long>(NB_SUBCOMMAND), static_cast<unsigned long>(NB_OPTION),
+             microPerRun(start, eagerEnd), microPerRun(eagerEnd, lazyEnd), static_cast<unsigned long>(check));
+    return 0;
+}
@@ -1,3 +1,5 @@
+#include <iostream>
+
 #include "argparsor.h"
 
 int main(int argc, char* argv[]) {
@@ -26,13 +26,18 @@
 #ifndef _MBLET_ARGPARSOR_HPP_
 #define _MBLET_ARGPARSOR_HPP_
 
-#include <map>
 #include <cstdarg>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <list>
+#include <utility>
 #include <sstream>
-#include <iostream>
+#include <ostream>
+#include <new>
+#include <stdexcept>
+
+#include "strto.h"
 
 namespace mblet {
 
@@ -99,9 +104,289 @@ class Argparsor {
     };
 
     /**
-     * @brief Argument object
+     * @brief Convert argument exception from ArgumentException,
+     *        argument is the value not converted
+     */
+    class ConvertArgumentException : public ArgumentException {
+      public:
+        ConvertArgumentException(const char* argument, const char* message, std::size_t index) :
+            ArgumentException(argument, message), _index(index) {}
+        virtual ~ConvertArgumentException() throw() {}
+        /**
+         * @brief Get the index of the first value not converted
+         *
+         * @return std::size_t
+         */
+        std::size_t index() const throw() {
+            return _index;
+        }
+      protected:
+        std::size_t _index;
+    };
+
+    /**
+     * @brief Destination of the usage and error messages
+     */
+    class Output {
+      public:
+        virtual ~Output() {}
+        /**
+         * @brief Write a part of message
+         *
+         * @param data
+         * @param size
+         */
+        virtual void write(const char* data, std::size_t size) = 0;
+    };
+
+    /**
+     * @brief Output adapter of a std::ostream
+     */
+    class StreamOutput : public Output {
+      public:
+        StreamOutput(std::ostream& oss) : _oss(oss) {}
+        virtual ~StreamOutput() {}
+        virtual void write(const char* data, std::size_t size) {
+            _oss.write(data, size);
+        }
+      private:
+        std::ostream& _oss;
+    };
+
+    /**
+     * @brief Output in a file descriptor
+     * buffer the message and flush it with one system call
+     */
+    class FdOutput : public Output {
+      public:
+        FdOutput(int fd) : _fd(fd), _size(0) {}
+        /**
+         * @brief Destroy the FdOutput object and flush the buffer
+         */
+        virtual ~FdOutput() {
+            flush();
+        }
+        virtual void write(const char* data, std::size_t size);
+        /**
+         * @brief Write the buffer in the file descriptor
+         */
+        void flush();
+      private:
+        FdOutput(const FdOutput&);
+        FdOutput& operator=(const FdOutput&);
+        int _fd;
+        std::size_t _size;
+        char _buffer[4096];
+    };
+
+    /**
+     * @brief View of a parsed value or of a group of values (append with nargs)
+     */
+    class Value {
+
+      public:
+
+        /**
+         * @brief Construct a new empty Value object
+         */
+        Value() : _data(NULL), _size(0), _items(NULL) {}
+
+        /**
+         * @brief Construct a new Value object of one value,
+         *        data must outlive the value
+         *
+         * @param data
+         * @param size
+         */
+        Value(const char* data, std::size_t size) : _data(data), _size(size), _items(NULL) {}
+
+        /**
+         * @brief Construct a new Value object of a group of values
+         *
+         * @param items
+         * @param size
+         */
+        Value(const Value* items, std::size_t size) : _data(NULL), _size(size), _items(items) {}
+
+        /**
+         * @brief Get the number of values in group (0 if is not a group)
+         *
+         * @return std::size_t
+         */
+        inline std::size_t size() const {
+            return (_items != NULL) ? _size : 0;
+        }
+
+        inline bool empty() const {
+            return size() == 0;
+        }
+
+        /**
+         * @brief Get the value of group at index
+         *
+         * @param index
+         * @return const Value&
+         */
+        inline const Value& at(std::size_t index) const {
+            if (index >= size()) {
+                throw std::out_of_range("value index out of range");
+            }
+            return _items[index];
+        }
+
+        /**
+         * @brief overide brakcet operator
+         *
+         * @param index
+         * @return const Value&
+         */
+        inline const Value& operator[](unsigned long index) const {
+            return at(index);
+        }
+
+        /**
+         * @brief Get the first value of group (NULL if is not a group)
+         *
+         * @return const Value*
+         */
+        inline const Value* begin() const {
+            return _items;
+        }
+
+        /**
+         * @brief Get the end of values of group
+         *
+         * @return const Value*
+         */
+        inline const Value* end() const {
+            return _items + size();
+        }
+
+        /**
+         * @brief Get the data of value (not null terminated)
+         *
+         * @return const char*
+         */
+        inline const char* data() const {
+            return _data;
+        }
+
+        /**
+         * @brief Get the size of data of value
+         *
+         * @return std::size_t
+         */
+        inline std::size_t length() const {
+            return (_items != NULL) ? 0 : _size;
+        }
+
+        /**
+         * @brief Get a copy of value
+         *
+         * @return std::string
+         */
+        inline std::string getArgument() const {
+            return std::string(_data, length());
+        }
+
+        /**
+         * @brief Write the value or values of group separate by ", " in os
+         *
+         * @param os
+         */
+        inline void write(std::ostream& os) const {
+            if (_items != NULL) {
+                for (std::size_t i = 0 ; i < _size ; ++i) {
+                    if (i > 0) {
+                        os << ", ";
+                    }
+                    _items[i].write(os);
+                }
+            }
+            else {
+                os.write(_data, _size);
+            }
+        }
+
+        /**
+         * @brief Append the value or values of group separate by ", " in str
+         *
+         * @param str
+         */
+        inline void append(std::string* str) const {
+            if (_items != NULL) {
+                for (std::size_t i = 0 ; i < _size ; ++i) {
+                    if (i > 0) {
+                        str->append(", ", 2);
+                    }
+                    _items[i].append(str);
+                }
+            }
+            else {
+                str->append(_data, _size);
+            }
+        }
+
+        inline std::string str() const {
+            if (_items != NULL) {
+                std::string ret;
+                append(&ret);
+                return ret;
+            }
+            return getArgument();
+        }
+
+        /**
+         * @brief tranform to string
+         *
+         * @return std::string
+         */
+        inline operator std::string() const {
+            return str();
+        }
+
+        /**
+         * @brief tranform group to vector of string
+         *
+         * @return std::vector<std::string>
+         */
+        inline operator std::vector<std::string>() const {
+            if (_items != NULL) {
+                std::vector<std::string> ret;
+                ret.reserve(_size);
+                for (std::size_t i = 0 ; i < _size ; ++i) {
+                    ret.push_back(_items[i].getArgument());
+                }
+                return ret;
+            }
+            else {
+                throw Exception("convertion to vector of string not authorized");
+            }
+        }
+
+        /**
+         * @brief Friend function for convert Value object to ostream
+         *
+         * @param os
+         * @param value
+         * @return std::ostream&
+         */
+        inline friend std::ostream& operator<<(std::ostream& os, const Value& value) {
+            value.write(os);
+            return os;
+        }
+
+      private:
+
+        const char* _data;
+        std::size_t _size;
+        const Value* _items;
+    };
+
+    /**
+     * @brief Values of argument found by a parse
      */
-    class Argument : public std::vector<Argument> {
+    class ParsedArgument {
 
       public:
 
@@ -119,18 +404,16 @@ class Argparsor {
         };
 
         /**
-         * @brief Construct a new Argument object
+         * @brief Construct a new ParsedArgument object
+         *
+         * @param arena values storage of argument
          */
-        Argument();
+        explicit ParsedArgument(const std::vector<Value>* arena = NULL);
 
         inline bool isExist() const {
             return _isExist;
         }
 
-        inline bool isRequired() const {
-            return _isRequired;
-        }
-
         inline std::size_t count() const {
             return _count;
         }
@@ -143,56 +426,56 @@ class Argparsor {
             return _type;
         }
 
-        inline const std::string& getHelp() const {
-            return _help;
-        }
-
-        inline const std::string& getArgHelp() const {
-            return _argHelp;
-        }
-
-        inline const std::string& getArgument() const {
-            return _argument;
-        }
-
-        inline const std::string& getDefaultValue() const {
-            return _defaultValue;
+        /**
+         * @brief Get the argument of simple option or positional argument
+         *
+         * @return std::string
+         */
+        inline std::string getArgument() const {
+            if ((_type == SIMPLE_OPTION || _type == POSITIONAL_ARGUMENT) && _valueCount > 0) {
+                return value(0).getArgument();
+            }
+            return std::string();
         }
 
         inline void setIsExist(bool isExist) {
             _isExist = isExist;
         }
 
-        inline void setIsRequired(bool isRequired) {
-            _isRequired = isRequired;
-        }
-
         inline void addCount() {
             ++_count;
         }
 
-        inline void setNbArgs(std::size_t nbArgs) {
-            _nbArgs = nbArgs;
-        }
-
-        inline void setType(enum Type type) {
-            _type = type;
-        }
-
-        inline void setHelp(const std::string& help) {
-            _help = help;
-        }
-
-        inline void setArgHelp(const std::string& argHelp) {
-            _argHelp = argHelp;
+        /**
+         * @brief Get the number of values (or of groups for MULTI_NUMBER_OPTION)
+         *
+         * @return std::size_t
+         */
+        inline std::size_t size() const {
+            if (_type == MULTI_NUMBER_OPTION) {
+                return _valueCount / _nbArgs;
+            }
+            return _valueCount;
         }
 
-        inline void setArgument(const std::string& argument) {
-            _argument = argument;
+        inline bool empty() const {
+            return _valueCount == 0;
         }
 
-        inline void setDefaultValue(const std::string& defaultValue) {
-            _defaultValue = defaultValue;
+        /**
+         * @brief Get the value (or the group for MULTI_NUMBER_OPTION) at index
+         *
+         * @param index
+         * @return Value
+         */
+        inline Value at(std::size_t index) const {
+            if (index >= size()) {
+                throw std::out_of_range("argument index out of range");
+            }
+            if (_type == MULTI_NUMBER_OPTION) {
+                return Value(&value(index * _nbArgs), _nbArgs);
+            }
+            return value(index);
         }
 
         inline bool boolean() const {
@@ -215,34 +498,81 @@ class Argparsor {
                 return ((_isExist) ? "false" : "true");
             }
             else {
-                std::ostringstream oss("");
-                if (!empty()) {
-                    for (std::size_t i = 0 ; i < size() ; ++i) {
-                        if (i > 0) {
-                            oss << ", ";
-                        }
-                        if (!at(i).empty()) {
-                            oss << "(";
-                            for (std::size_t j = 0 ; j < at(i).size() ; ++j) {
-                                if (j > 0) {
-                                    oss << ", ";
-                                }
-                                oss << at(i).at(j).getArgument();
-                            }
-                            oss << ")";
-                        }
-                        else {
-                            oss << at(i).getArgument();
-                        }
+                // size of values, separators and parenthesis
+                std::size_t length = 0;
+                for (std::size_t i = 0 ; i < _valueCount ; ++i) {
+                    length += value(i).length() + 2;
+                }
+                if (_type == MULTI_NUMBER_OPTION) {
+                    length += size() * 2;
+                }
+                std::string ret;
+                ret.reserve(length);
+                for (std::size_t i = 0 ; i < size() ; ++i) {
+                    if (i > 0) {
+                        ret.append(", ", 2);
+                    }
+                    if (_type == MULTI_NUMBER_OPTION) {
+                        ret.push_back('(');
+                        at(i).append(&ret);
+                        ret.push_back(')');
+                    }
+                    else {
+                        value(i).append(&ret);
                     }
                 }
-                else {
-                    oss << _argument;
+                return ret;
+            }
+        }
+
+        /**
+         * @brief Write the values as str() in os without intermediate string
+         *
+         * @param os
+         */
+        inline void write(std::ostream& os) const {
+            if (_type == BOOLEAN_OPTION) {
+                os << ((_isExist) ? "true" : "false");
+            }
+            else if (_type == REVERSE_BOOLEAN_OPTION) {
+                os << ((_isExist) ? "false" : "true");
+            }
+            else {
+                for (std::size_t i = 0 ; i < size() ; ++i) {
+                    if (i > 0) {
+                        os.write(", ", 2);
+                    }
+                    if (_type == MULTI_NUMBER_OPTION) {
+                        os.put('(');
+                        at(i).write(os);
+                        os.put(')');
+                    }
+                    else {
+                        value(i).write(os);
+                    }
                 }
-                return oss.str();
             }
         }
 
+        /**
+         * @brief Get the first value, values are contiguous
+         *        (the values of groups of MULTI_NUMBER_OPTION follow each other)
+         *
+         * @return const Value*
+         */
+        inline const Value* begin() const {
+            return (_valueCount > 0) ? &value(0) : NULL;
+        }
+
+        /**
+         * @brief Get the end of values
+         *
+         * @return const Value*
+         */
+        inline const Value* end() const {
+            return begin() + _valueCount;
+        }
+
         /**
          * @brief Override bool operator
          *
@@ -270,8 +600,9 @@ class Argparsor {
             if (_type == NUMBER_OPTION || _type == MULTI_OPTION ||
                 _type == INFINITE_OPTION || _type == MULTI_INFINITE_OPTION) {
                 std::vector<std::string> ret;
-                for (std::size_t i = 0 ; i < size() ; ++i) {
-                    ret.push_back(at(i).getArgument());
+                ret.reserve(_valueCount);
+                for (std::size_t i = 0 ; i < _valueCount ; ++i) {
+                    ret.push_back(value(i).getArgument());
                 }
                 return ret;
             }
@@ -288,11 +619,9 @@ class Argparsor {
         inline operator std::vector<std::vector<std::string> >() const {
             if (_type == MULTI_NUMBER_OPTION) {
                 std::vector<std::vector<std::string> > ret;
+                ret.reserve(size());
                 for (std::size_t i = 0 ; i < size() ; ++i) {
-                    ret.push_back(std::vector<std::string>());
-                    for (std::size_t j = 0 ; j < at(i).size() ; ++j) {
-                        ret[i].push_back(at(i).at(j).getArgument());
-                    }
+                    ret.push_back(at(i));
                 }
                 return ret;
             }
@@ -302,252 +631,1864 @@ class Argparsor {
         }
 
         /**
-         * @brief overide brakcet operator
+         * @brief Convert the argument of simple option or positional argument with strto,
+         *        or all values if T is a std::vector
          *
-         * @param index
-         * @return const Argument&
+         * @tparam T
+         * @return T
          */
-        inline const Argument& operator[](unsigned long index) const {
-            return at(index);
+        template<typename T>
+        inline T as() const {
+            T ret;
+            as(&ret);
+            return ret;
         }
 
         /**
-         * @brief Friend function for convert Argument object to ostream
+         * @brief Convert the argument of simple option or positional argument with strto in ret,
+         *        or all values in one reserved buffer if ret is a std::vector.
+         *        Throw a ConvertArgumentException with the index of the first value not converted
+         *
+         * @tparam T
+         * @param ret
+         */
+        template<typename T>
+        inline void as(T* ret) const {
+            if ((_type != SIMPLE_OPTION && _type != POSITIONAL_ARGUMENT) || _valueCount == 0) {
+                throw Exception("convertion not authorized");
+            }
+            *ret = convert<T>(0);
+        }
+
+        template<typename T>
+        inline void as(std::vector<T>* ret) const {
+            if (_type != NUMBER_OPTION && _type != MULTI_OPTION &&
+                _type != INFINITE_OPTION && _type != MULTI_INFINITE_OPTION) {
+                throw Exception("convertion to vector not authorized");
+            }
+            ret->clear();
+            ret->reserve(_valueCount);
+            for (std::size_t i = 0 ; i < _valueCount ; ++i) {
+                ret->push_back(convert<T>(i));
+            }
+        }
+
+        /**
+         * @brief Convert the argument as as<T>() at the first call and keep the value until the next parse.
+         *        T must be an arithmetic type, the cache is not thread safe
+         *
+         * @tparam T
+         * @return T
+         */
+        template<typename T>
+        inline T get() const {
+            // T must fit in cache
+            char isCacheable[(sizeof(T) <= sizeof(_cache)) ? 1 : -1];
+            (void)isCacheable;
+            T ret;
+            if (_cacheTag != &CacheTag<T>::tag) {
+                ret = as<T>();
+                std::memcpy(_cache, &ret, sizeof(T));
+                _cacheTag = &CacheTag<T>::tag;
+            }
+            else {
+                std::memcpy(&ret, _cache, sizeof(T));
+            }
+            return ret;
+        }
+
+        /**
+         * @brief Convert all values in ret as as(std::vector<T>*) with the values split in nbThread threads
+         *        (0 for the number of processors).
+         *        Throw the ConvertArgumentException of the lowest index not converted,
+         *        an other exception of a thread is thrown again after the join
+         *
+         * @tparam T
+         * @param ret
+         * @param nbThread
+         */
+        template<typename T>
+        inline void as(std::vector<T>* ret, std::size_t nbThread) const {
+            // minimum of values converted by a thread
+            const std::size_t minChunkSize = 4096;
+            if (nbThread == 0) {
+                nbThread = getNbProcessor();
+            }
+            if (nbThread > _valueCount / minChunkSize) {
+                nbThread = _valueCount / minChunkSize;
+            }
+            if (nbThread <= 1) {
+                as(ret);
+                return;
+            }
+            if (_type != NUMBER_OPTION && _type != MULTI_OPTION &&
+                _type != INFINITE_OPTION && _type != MULTI_INFINITE_OPTION) {
+                throw Exception("convertion to vector not authorized");
+            }
+            ret->resize(_valueCount);
+            std::vector<ConvertChunk<T> > chunks(nbThread);
+            for (std::size_t i = 0 ; i < nbThread ; ++i) {
+                chunks[i].argument = this;
+                chunks[i].ret = &(*ret)[0];
+                chunks[i].begin = _valueCount * i / nbThread;
+                chunks[i].end = _valueCount * (i + 1) / nbThread;
+                chunks[i].isError = false;
+                chunks[i].index = 0;
+                chunks[i].isBadAlloc = false;
+                chunks[i].isUnexpected = false;
+            }
+            runThreads(&convertChunk<T>, &chunks[0], sizeof(ConvertChunk<T>), nbThread);
+            // chunks are in order so the first error is the lowest index
+            for (std::size_t i = 0 ; i < nbThread ; ++i) {
+                if (chunks[i].isBadAlloc) {
+                    throw std::bad_alloc();
+                }
+                if (chunks[i].isUnexpected) {
+                    throw Exception(chunks[i].error);
+                }
+                if (chunks[i].isError) {
+                    throw ConvertArgumentException(chunks[i].value.c_str(), chunks[i].message.c_str(),
+                                                   chunks[i].index);
+                }
+            }
+        }
+
+        /**
+         * @brief Convert all values in ret as as(std::vector<bool>*),
+         *        the bits of std::vector<bool> cannot be written by many threads
+         *
+         * @param ret
+         * @param nbThread unused
+         */
+        inline void as(std::vector<bool>* ret, std::size_t /*nbThread*/) const {
+            as(ret);
+        }
+
+        /**
+         * @brief overide brakcet operator
+         *
+         * @param index
+         * @return Value
+         */
+        inline Value operator[](unsigned long index) const {
+            return at(index);
+        }
+
+        /**
+         * @brief Friend function for convert ParsedArgument object to ostream
          *
          * @param os
          * @param map
          * @return std::ostream&
          */
-        inline friend std::ostream& operator<<(std::ostream& os, const Argument& map) {
-            os << map.str();
+        inline friend std::ostream& operator<<(std::ostream& os, const ParsedArgument& map) {
+            map.write(os);
             return os;
         }
 
-        std::vector<std::string> names;
         bool _isExist;
-        bool _isRequired;
         std::size_t _count;
         std::size_t _nbArgs;
         enum Type _type;
+        // range of values in arena
+        const std::vector<Value>* _arena;
+        std::size_t _valueIndex;
+        std::size_t _valueCount;
+        // number of clear of values in current parse
+        std::size_t _clearCount;
+        std::size_t _pendingCount;
+        // value converted by get<T> and address of the tag of T (NULL if empty)
+        mutable unsigned char _cache[sizeof(long double)];
+        mutable const char* _cacheTag;
+
+      private:
+
+        inline const Value& value(std::size_t index) const {
+            return (*_arena)[_valueIndex + index];
+        }
+
+        template<typename T>
+        inline T convert(std::size_t index) const {
+            const Value& v = value(index);
+            try {
+                return strto<T>(v.data(), v.length());
+            }
+            catch (const StrToException& e) {
+                throw ConvertArgumentException(e.value(), e.what(), index);
+            }
+        }
+
+        /**
+         * @brief Address of tag is an unique identifier of T for the cache of get<T>
+         */
+        template<typename T>
+        struct CacheTag {
+            static char tag;
+        };
+
+        /**
+         * @brief Range of values converted by a thread of as(std::vector<T>*, nbThread)
+         */
+        template<typename T>
+        struct ConvertChunk {
+            const ParsedArgument* argument;
+            T* ret;
+            std::size_t begin;
+            std::size_t end;
+            // first error of range
+            bool isError;
+            std::string value;
+            std::string message;
+            std::size_t index;
+            // unexpected exception, the message is not allocated
+            bool isBadAlloc;
+            bool isUnexpected;
+            char error[128];
+        };
+
+        /**
+         * @brief Convert the values of range of chunk and stop at the first error
+         *
+         * @tparam T
+         * @param data ConvertChunk
+         * @return void* NULL
+         */
+        template<typename T>
+        static void* convertChunk(void* data) {
+            ConvertChunk<T>* chunk = static_cast<ConvertChunk<T>*>(data);
+            // an exception out of the routine of thread calls std::terminate
+            try {
+                try {
+                    for (std::size_t i = chunk->begin ; i < chunk->end ; ++i) {
+                        chunk->ret[i] = chunk->argument->template convert<T>(i);
+                    }
+                }
+                catch (const ConvertArgumentException& e) {
+                    chunk->isError = true;
+                    chunk->index = e.index();
+                    chunk->value = e.argument();
+                    chunk->message = e.what();
+                }
+            }
+            catch (const std::bad_alloc&) {
+                chunk->isBadAlloc = true;
+            }
+            catch (const std::exception& e) {
+                chunk->isUnexpected = true;
+                std::strncpy(chunk->error, e.what(), sizeof(chunk->error) - 1);
+                chunk->error[sizeof(chunk->error) - 1] = '\0';
+            }
+            catch (...) {
+                chunk->isUnexpected = true;
+                std::strcpy(chunk->error, "unknown exception");
+            }
+            return NULL;
+        }
+
+        /**
+         * @brief Get the number of processors online
+         *
+         * @return std::size_t
+         */
+        static std::size_t getNbProcessor();
+
+        /**
+         * @brief Call routine with each data in nbThread threads (the first in the current thread)
+         *
+         * @param routine
+         * @param data array of nbThread data
+         * @param dataSize size of a data
+         * @param nbThread
+         */
+        static void runThreads(void* (*routine)(void*), void* data, std::size_t dataSize, std::size_t nbThread);
+
+    };
+
+    /**
+     * @brief Argument object
+     */
+    class Argument : public ParsedArgument {
+
+      public:
+
+        /**
+         * @brief Construct a new Argument object
+         *
+         * @param arena values storage of argument
+         * @param index index of argument in the parse results
+         */
+        explicit Argument(const std::vector<Value>* arena = NULL, std::size_t index = 0);
+
+        inline bool isRequired() const {
+            return _isRequired;
+        }
+
+        inline const std::string& getHelp() const {
+            return _help;
+        }
+
+        inline const std::string& getArgHelp() const {
+            return _argHelp;
+        }
+
+        inline const std::string& getDefaultValue() const {
+            return _defaultValue;
+        }
+
+        inline const std::string& getEnvironmentVariable() const {
+            return _environmentVariable;
+        }
+
+        inline void setIsRequired(bool isRequired) {
+            _isRequired = isRequired;
+        }
+
+        inline void setNbArgs(std::size_t nbArgs) {
+            _nbArgs = nbArgs;
+        }
+
+        inline void setType(enum Type type) {
+            _type = type;
+        }
+
+        inline void setHelp(const std::string& help) {
+            _help = help;
+        }
+
+        inline void setArgHelp(const std::string& argHelp) {
+            _argHelp = argHelp;
+        }
+
+        inline void setDefaultValue(const std::string& defaultValue) {
+            _defaultValue = defaultValue;
+        }
+
+        std::vector<std::string> names;
+        bool _isRequired;
         std::string _help;
         std::string _argHelp;
-        std::string _argument;
         std::string _defaultValue;
+        // storage of default values referenced by arena
+        std::vector<std::string> _defaultArguments;
+        // name of variable used if argument is not in arguments of parse
+        std::string _environmentVariable;
+        // index of argument in the parse results
+        std::size_t _index;
+    };
+
+    /**
+     * @brief Result of a parse with Argparsor::parse.
+     *        Many results can be parsed at same time from the same Argparsor object
+     */
+    class Result {
+
+        friend class Argparsor;
+
+      public:
+
+        /**
+         * @brief Construct a new empty Result object
+         */
+        Result();
+
+        /**
+         * @brief Destroy the Result object
+         */
+        ~Result();
+
+        /**
+         * @brief Get the bynary name
+         *
+         * @return const std::string&
+         */
+        inline const std::string& getBynaryName() const {
+            return _binaryName;
+        }
+
+        /**
+         * @brief Get the parsed argument object
+         *
+         * @param str
+         * @return const ParsedArgument&
+         */
+        inline const ParsedArgument& getOption(const char* str) const {
+            if (_argparsor == NULL) {
+                throw AccessDeniedException(str, "option not found");
+            }
+            return _arguments[_argparsor->getOption(str)._index];
+        }
+
+        /**
+         * @brief Get the parsed argument object
+         *
+         * @param str
+         * @return const ParsedArgument&
+         */
+        inline const ParsedArgument& getOption(const std::string& str) const {
+            if (_argparsor == NULL) {
+                throw AccessDeniedException(str.c_str(), "option not found");
+            }
+            return _arguments[_argparsor->getOption(str)._index];
+        }
+
+        /**
+         * @brief Override bracket operator with getOption
+         *
+         * @param str
+         * @return const ParsedArgument&
+         */
+        inline const ParsedArgument& operator[](const char* str) const {
+            return getOption(str);
+        }
+
+        /**
+         * @brief Override bracket operator with getOption
+         *
+         * @param str
+         * @return const ParsedArgument&
+         */
+        inline const ParsedArgument& operator[](const std::string& str) const {
+            return getOption(str);
+        }
+
+        /**
+         * @brief Get the vector of additional argument
+         *
+         * @return const std::vector<std::string>&
+         */
+        inline const std::vector<std::string>& getAdditionalArguments() const {
+            return _additionalArguments;
+        }
+
+        /**
+         * @brief Help option is found by the parse (the parse does not write the usage and does not exit)
+         *
+         * @return true if help option is found
+         */
+        inline bool isHelpRequested() const {
+            return _isHelpRequested;
+        }
+
+        /**
+         * @brief Get the name of subcommand found by the parse
+         *
+         * @return const std::string& or empty if there is not subcommand
+         */
+        inline const std::string& getSubcommandName() const {
+            return _subcommandName;
+        }
+
+        /**
+         * @brief Get the result of subcommand found by the parse
+         *
+         * @return const Result&
+         */
+        inline const Result& getSubcommand() const {
+            if (_subcommandName.empty() || _subcommand == NULL) {
+                throw AccessDeniedException(_subcommandName.c_str(), "subcommand not found");
+            }
+            return *_subcommand;
+        }
+
+      private:
+
+        // values are views of arena and of argv copy
+        Result(const Result&);
+        Result& operator=(const Result&);
+
+        const Argparsor* _argparsor;
+        std::string _binaryName;
+        std::vector<ParsedArgument> _arguments;
+        std::vector<Value> _values;
+        std::list<std::string> _argvCopies;
+        std::vector<std::pair<void*, std::size_t> > _mappedFiles;
+        std::vector<std::string> _additionalArguments;
+        bool _isHelpRequested;
+        std::string _subcommandName;
+        // result of subcommand, kept for the next parses
+        Result* _subcommand;
+    };
+
+    /**
+     * @brief Results of a parse of many command lines with Argparsor::parseBatch
+     */
+    class Batch {
+
+        friend class Argparsor;
+
+      public:
+
+        /**
+         * @brief Construct a new empty Batch object
+         */
+        Batch();
+
+        /**
+         * @brief Destroy the Batch object
+         */
+        ~Batch();
+
+        /**
+         * @brief Get the number of command lines
+         *
+         * @return std::size_t
+         */
+        inline std::size_t size() const {
+            return _size;
+        }
+
+        /**
+         * @brief Get the result of command line at index
+         *
+         * @param index
+         * @return const Result&
+         */
+        inline const Result& at(std::size_t index) const {
+            if (index >= _size) {
+                throw std::out_of_range("batch index out of range");
+            }
+            return _results[index];
+        }
+
+        /**
+         * @brief overide brakcet operator
+         *
+         * @param index
+         * @return const Result&
+         */
+        inline const Result& operator[](unsigned long index) const {
+            return at(index);
+        }
+
+        /**
+         * @brief Get the error of parse of command line at index
+         *
+         * @param index
+         * @return const ParseArgumentException* or NULL if parse is valid
+         */
+        inline const ParseArgumentException* getError(std::size_t index) const {
+            if (index >= _size) {
+                throw std::out_of_range("batch index out of range");
+            }
+            return _errors[index];
+        }
+
+      private:
+
+        // results are not copyable
+        Batch(const Batch&);
+        Batch& operator=(const Batch&);
+
+        /**
+         * @brief Remove all results and create size empty results
+         *
+         * @param size
+         */
+        void clear(std::size_t size);
+
+        std::size_t _size;
+        Result* _results;
+        std::vector<ParseArgumentException*> _errors;
+        // arguments of each command line separate by '\0'
+        std::vector<std::string> _commands;
+    };
+
+    /**
+     * @brief Read-only copy of a parsed state in one block of shared memory.
+     *        The block has offsets and not pointers, the forked processes read the same physical pages
+     */
+    class Snapshot {
+
+        friend class Argparsor;
+
+      public:
+
+        /**
+         * @brief Location of a string in block
+         */
+        struct String {
+            std::size_t offset;
+            std::size_t size;
+        };
+
+        /**
+         * @brief Parsed argument in block
+         */
+        struct Record {
+            String name;
+            std::size_t type;
+            std::size_t isExist;
+            std::size_t count;
+            std::size_t nbArgs;
+            std::size_t nbValue;
+            // offset of nbValue String
+            std::size_t values;
+        };
+
+        /**
+         * @brief Slot of name of argument in block (index of Record + 1, 0 if slot is empty)
+         */
+        struct Slot {
+            String name;
+            std::size_t index;
+        };
+
+        /**
+         * @brief Start of block
+         */
+        struct Header {
+            std::size_t nbRecord;
+            std::size_t records;
+            // number of slots is a power of two
+            std::size_t nbSlot;
+            std::size_t slots;
+            String binaryName;
+            std::size_t nbAdditionalArgument;
+            std::size_t additionalArguments;
+        };
+
+        /**
+         * @brief View of a value or of a group of values (MULTI_NUMBER_OPTION) of block
+         */
+        class Value {
+
+          public:
+
+            Value(const char* block, const String* items, std::size_t size, bool isGroup) :
+                _block(block), _items(items), _size(size), _isGroup(isGroup) {}
+
+            /**
+             * @brief Get the number of values in group (0 if is not a group)
+             *
+             * @return std::size_t
+             */
+            inline std::size_t size() const {
+                return (_isGroup) ? _size : 0;
+            }
+
+            inline bool empty() const {
+                return size() == 0;
+            }
+
+            inline Value at(std::size_t index) const {
+                if (index >= size()) {
+                    throw std::out_of_range("value index out of range");
+                }
+                return Value(_block, _items + index, 1, false);
+            }
+
+            inline Value operator[](unsigned long index) const {
+                return at(index);
+            }
+
+            /**
+             * @brief Get the data of value (not null terminated)
+             *
+             * @return const char*
+             */
+            inline const char* data() const {
+                return (_isGroup) ? NULL : _block + _items->offset;
+            }
+
+            inline std::size_t length() const {
+                return (_isGroup) ? 0 : _items->size;
+            }
+
+            inline std::string getArgument() const {
+                return std::string(data(), length());
+            }
+
+            /**
+             * @brief Get the value or values of group separate by ", "
+             *
+             * @return std::string
+             */
+            inline std::string str() const {
+                if (!_isGroup) {
+                    return getArgument();
+                }
+                std::string ret;
+                for (std::size_t i = 0 ; i < _size ; ++i) {
+                    if (i > 0) {
+                        ret.append(", ", 2);
+                    }
+                    ret.append(_block + _items[i].offset, _items[i].size);
+                }
+                return ret;
+            }
+
+            inline operator std::string() const {
+                return str();
+            }
+
+          private:
+
+            const char* _block;
+            const String* _items;
+            std::size_t _size;
+            bool _isGroup;
+        };
+
+        /**
+         * @brief View of a parsed argument of block with the accessors of ParsedArgument
+         */
+        class Argument {
+
+          public:
+
+            Argument(const char* block, const Record* record) : _block(block), _record(record) {}
+
+            inline bool isExist() const {
+                return _record->isExist != 0;
+            }
+
+            inline std::size_t count() const {
+                return _record->count;
+            }
+
+            inline std::size_t nbArgs() const {
+                return _record->nbArgs;
+            }
+
+            inline ParsedArgument::Type getType() const {
+                return static_cast<ParsedArgument::Type>(_record->type);
+            }
+
+            /**
+             * @brief Get the number of values (or of groups for MULTI_NUMBER_OPTION)
+             *
+             * @return std::size_t
+             */
+            inline std::size_t size() const {
+                if (getType() == ParsedArgument::MULTI_NUMBER_OPTION) {
+                    return _record->nbValue / _record->nbArgs;
+                }
+                return _record->nbValue;
+            }
+
+            inline bool empty() const {
+                return _record->nbValue == 0;
+            }
+
+            /**
+             * @brief Get the value (or the group for MULTI_NUMBER_OPTION) at index
+             *
+             * @param index
+             * @return Value
+             */
+            inline Value at(std::size_t index) const {
+                if (index >= size()) {
+                    throw std::out_of_range("argument index out of range");
+                }
+                if (getType() == ParsedArgument::MULTI_NUMBER_OPTION) {
+                    return Value(_block, values() + index * _record->nbArgs, _record->nbArgs, true);
+                }
+                return Value(_block, values() + index, 1, false);
+            }
+
+            inline Value operator[](unsigned long index) const {
+                return at(index);
+            }
+
+            inline bool boolean() const {
+                if (getType() == ParsedArgument::BOOLEAN_OPTION) {
+                    return isExist();
+                }
+                else if (getType() == ParsedArgument::REVERSE_BOOLEAN_OPTION) {
+                    return !isExist();
+                }
+                else {
+                    throw Exception("convertion to bool not authorized");
+                }
+            }
+
+            /**
+             * @brief Get the argument of simple option or positional argument
+             *
+             * @return std::string
+             */
+            inline std::string getArgument() const {
+                if ((getType() == ParsedArgument::SIMPLE_OPTION || getType() == ParsedArgument::POSITIONAL_ARGUMENT) &&
+                    _record->nbValue > 0) {
+                    return at(0).getArgument();
+                }
+                return std::string();
+            }
+
+            inline std::string str() const {
+                if (getType() == ParsedArgument::BOOLEAN_OPTION ||
+                    getType() == ParsedArgument::REVERSE_BOOLEAN_OPTION) {
+                    return (boolean()) ? "true" : "false";
+                }
+                std::string ret;
+                for (std::size_t i = 0 ; i < size() ; ++i) {
+                    if (i > 0) {
+                        ret.append(", ", 2);
+                    }
+                    if (getType() == ParsedArgument::MULTI_NUMBER_OPTION) {
+                        ret.push_back('(');
+                        ret.append(at(i).str());
+                        ret.push_back(')');
+                    }
+                    else {
+                        ret.append(at(i).str());
+                    }
+                }
+                return ret;
+            }
+
+            /**
+             * @brief Convert the argument of simple option or positional argument with strto
+             *
+             * @tparam T
+             * @return T
+             */
+            template<typename T>
+            inline T as() const {
+                if ((getType() != ParsedArgument::SIMPLE_OPTION && getType() != ParsedArgument::POSITIONAL_ARGUMENT) ||
+                    _record->nbValue == 0) {
+                    throw Exception("convertion not authorized");
+                }
+                try {
+                    return strto<T>(_block + values()->offset, values()->size);
+                }
+                catch (const StrToException& e) {
+                    throw ConvertArgumentException(e.value(), e.what(), 0);
+                }
+            }
+
+            inline operator bool() const {
+                return isExist();
+            }
+
+            inline operator std::string() const {
+                return str();
+            }
+
+          private:
+
+            inline const String* values() const {
+                return reinterpret_cast<const String*>(_block + _record->values);
+            }
+
+            const char* _block;
+            const Record* _record;
+        };
+
+        /**
+         * @brief Construct a new empty Snapshot object
+         */
+        Snapshot();
+
+        /**
+         * @brief Destroy the Snapshot object and unmap its block
+         */
+        ~Snapshot();
+
+        /**
+         * @brief Get the parsed argument of a name of argument
+         *
+         * @param str
+         * @return Argument
+         */
+        Argument getOption(const char* str) const;
+
+        inline Argument getOption(const std::string& str) const {
+            return getOption(str.c_str());
+        }
+
+        inline Argument operator[](const char* str) const {
+            return getOption(str);
+        }
+
+        inline Argument operator[](const std::string& str) const {
+            return getOption(str.c_str());
+        }
+
+        inline std::string getBynaryName() const {
+            const Header* header = reinterpret_cast<const Header*>(_block);
+            if (header == NULL) {
+                return std::string();
+            }
+            return std::string(_block + header->binaryName.offset, header->binaryName.size);
+        }
+
+        /**
+         * @brief Get a copy of additional arguments
+         *
+         * @return std::vector<std::string>
+         */
+        std::vector<std::string> getAdditionalArguments() const;
+
+        /**
+         * @brief Get the block
+         *
+         * @return const void*
+         */
+        inline const void* data() const {
+            return _block;
+        }
+
+        /**
+         * @brief Get the size of block
+         *
+         * @return std::size_t
+         */
+        inline std::size_t size() const {
+            return _size;
+        }
+
+      private:
+
+        // block is unmapped by destructor
+        Snapshot(const Snapshot&);
+        Snapshot& operator=(const Snapshot&);
+
+        char* _block;
+        std::size_t _size;
+    };
+
+    /**
+     * @brief Construct a new Argparsor object
+     */
+    Argparsor();
+
+    /**
+     * @brief Destroy the Argparsor object
+     */
+    ~Argparsor();
+
+    /**
+     * @brief Get the bynary name
+     *
+     * @return const std::string&
+     */
+    inline const std::string& getBynaryName() const {
+        return _binaryName;
+    }
+
+    /**
+     * @brief Write the usage in std::cout
+     *
+     * @return std::ostream&
+     */
+    std::ostream& getUsage() const;
+
+    /**
+     * @brief Get the usage object
+     *
+     * @param oss
+     * @return std::ostream&
+     */
+    inline std::ostream& getUsage(std::ostream& oss) const {
+        StreamOutput output(oss);
+        writeUsage(output, _binaryName);
+        return oss;
+    }
+
+    /**
+     * @brief Write the usage in a file descriptor without iostream
+     *
+     * @param fd
+     */
+    inline void getUsage(int fd) const {
+        FdOutput output(fd);
+        writeUsage(output, _binaryName);
+    }
+
+    /**
+     * @brief Write the usage in a output
+     *
+     * @param output
+     */
+    inline void getUsage(Output& output) const {
+        writeUsage(output, _binaryName);
+    }
+
+    /**
+     * @brief Write the error message of exception like "binaryname: message -- 'argument'"
+     *
+     * @param output
+     * @param e
+     */
+    void writeError(Output& output, const ArgumentException& e) const;
+
+    /**
+     * @brief Write the error message of exception in a file descriptor
+     *
+     * @param fd
+     * @param e
+     */
+    inline void writeError(int fd, const ArgumentException& e) const {
+        FdOutput output(fd);
+        writeError(output, e);
+    }
+
+    /**
+     * @brief Get the argument object
+     *
+     * @param str
+     * @return const Argument&
+     */
+    inline const Argument& getOption(const char* str) const {
+        const Argument* argument = _argumentFromName.find(str, ::strlen(str));
+        if (argument == NULL) {
+            throw AccessDeniedException(str, "option not found");
+        }
+        return *argument;
+    }
+
+    /**
+     * @brief Get the argument object
+     *
+     * @param str
+     * @return const Argument&
+     */
+    inline const Argument& getOption(const std::string& str) const {
+        const Argument* argument = _argumentFromName.find(str);
+        if (argument == NULL) {
+            throw AccessDeniedException(str.c_str(), "option not found");
+        }
+        return *argument;
+    }
+
+    /**
+     * @brief Override bracket operator with getOption
+     *
+     * @param str
+     * @return const Argument&
+     */
+    inline const Argument& operator[](const char* str) const {
+        return getOption(str);
+    }
+
+    /**
+     * @brief Override bracket operator with getOption
+     *
+     * @param str
+     * @return const Argument&
+     */
+    inline const Argument& operator[](const std::string& str) const {
+        return getOption(str);
+    }
+
+    /**
+     * @brief Get the vector of additional argument
+     *
+     * @return const std::vector<std::string>&
+     */
+    inline const std::vector<std::string>& getAdditionalArguments() const {
+        return _additionalArguments;
+    }
+
+    /**
+     * @brief Set the usage message
+     *
+     * @param usage
+     */
+    inline void setUsage(const char* usage) {
+        _usage = usage;
+        _isUsageCached = false;
+    }
+
+    /**
+     * @brief Set the description in usage message
+     *
+     * @param description
+     */
+    inline void setDescription(const char* description) {
+        _description = description;
+        _isUsageCached = false;
+    }
+
+    /**
+     * @brief Set the epilog in usage message
+     *
+     * @param epilog
+     */
+    inline void setEpilog(const char* epilog) {
+        _epilog = epilog;
+        _isUsageCached = false;
+    }
+
+    /**
+     * @brief Store the parsed arguments as views of argv without copy.
+     *        When enabled, argv must outlive the Argparsor object
+     *
+     * @param zeroCopy
+     */
+    inline void setZeroCopy(bool zeroCopy) {
+        _zeroCopy = zeroCopy;
+    }
+
+    /**
+     * @brief Set the prefix characters of arguments replaced by the arguments of a file (as "@" for "@args.txt").
+     *        Arguments of file are separate by spaces or newlines and can be quoted by ' or " or escaped by '\'.
+     *        Empty for disable (default)
+     *
+     * @param prefixChars
+     */
+    inline void setFromFilePrefixChars(const char* prefixChars) {
+        _fromFilePrefixChars = prefixChars;
+    }
+
+    /**
+     * @brief Function called for each additional argument
+     *
+     * @param argument view of argument valid only during the call
+     * @param size size of argument
+     * @param data user data of setAdditionalArgumentCallback
+     */
+    typedef void (*AdditionalArgumentCallback)(const char* argument, std::size_t size, void* data);
+
+    /**
+     * @brief Call callback for each additional argument as soon as it is parsed instead of keep it in
+     *        getAdditionalArguments (not used by parseBatch). NULL for disable (default)
+     *
+     * @param callback
+     * @param data
+     */
+    inline void setAdditionalArgumentCallback(AdditionalArgumentCallback callback, void* data = NULL) {
+        _additionalArgumentCallback = callback;
+        _additionalArgumentData = data;
+    }
+
+    /**
+     * @brief Use the value of environment variable if argument is not found by the parse (not used by parseBatch).
+     *        Boolean option is found if variable is true (see strto<bool>),
+     *        values of option with many values are separate by spaces and can be quoted by ' or " or escaped by '\'.
+     *        Empty variable for disable
+     *
+     * @param nameOrFlag
+     * @param variable
+     */
+    void setEnvironmentVariable(const char* nameOrFlag, const char* variable);
+
+    /**
+     * @brief Use the values of a configuration file for the options not found by the parse and not found in
+     *        environment (not used by parseBatch).
+     *        Lines are "key = value" where key is a long option without "--" ("[section]" adds "section-" before
+     *        the next keys), lines start with '#' or ';' are comments.
+     *        Value of simple option is all the end of line, values of option with many values are separate by spaces
+     *        and can be quoted by ' or " or escaped by '\'. Empty for disable (default)
+     *
+     * @param filename
+     */
+    inline void setConfigFile(const char* filename) {
+        _configFile = filename;
+    }
+
+    /**
+     * @brief Function called for add the arguments of a subcommand
+     *
+     * @param argparsor empty argparsor of subcommand
+     * @param data user data of addSubcommand
+     */
+    typedef void (*SubcommandBuilder)(Argparsor& argparsor, void* data);
+
+    /**
+     * @brief Add a subcommand selected by the first positional argument, all next arguments are parsed by the
+     *        argparsor of subcommand. The builder is called at the first parse of subcommand only
+     *
+     * @param name
+     * @param builder
+     * @param help
+     * @param data
+     */
+    void addSubcommand(const char* name, SubcommandBuilder builder, const char* help = NULL, void* data = NULL);
+
+    /**
+     * @brief Get the name of subcommand found by parseArguments
+     *
+     * @return const std::string& or empty if there is not subcommand
+     */
+    inline const std::string& getSubcommandName() const {
+        return _subcommandName;
+    }
+
+    /**
+     * @brief Get the argparsor of subcommand found by parseArguments with its parsed arguments
+     *
+     * @return const Argparsor&
+     */
+    const Argparsor& getSubcommand() const;
+
+    /**
+     * @brief Parse arguments
+     *
+     * @param argc
+     * @param argv
+     * @param alternative
+     * @param strict
+     */
+    void parseArguments(int argc, char* argv[], bool alternative = false, bool strict = false);
+
+    /**
+     * @brief Clear the result of the previous parses and restore the default values.
+     *        The arguments added are kept for the next parse
+     */
+    void reset();
+
+    /**
+     * @brief Parse arguments in result without modify the Argparsor object.
+     *        Many threads can parse at same time while no argument is added
+     *        and parseArguments or reset is not called.
+     *        The help option does not write the usage and does not exit the process: see Result::isHelpRequested,
+     *        the required arguments are not checked when help option is found
+     *
+     * @param argc
+     * @param argv
+     * @param result
+     * @param alternative
+     * @param strict
+     */
+    void parse(int argc, char* argv[], Result* result, bool alternative = false, bool strict = false) const;
+
+    /**
+     * @brief Parse each line of buffer as a command line (the first argument is the binary name)
+     *        in nbThread threads (0 for the number of processors).
+     *        Arguments are separate by spaces and can be quoted by ' or " or escaped by '\'.
+     *        An error of parse is kept in batch for its line and the help option not exit
+     *
+     * @param buffer
+     * @param size
+     * @param batch
+     * @param alternative
+     * @param strict
+     * @param nbThread
+     */
+    void parseBatch(const char* buffer, std::size_t size, Batch* batch, bool alternative = false,
+                    bool strict = false, std::size_t nbThread = 0) const;
+
+    /**
+     * @brief Parse each line of file as a command line with parseBatch
+     *
+     * @param filename
+     * @param batch
+     * @param alternative
+     * @param strict
+     * @param nbThread
+     */
+    void parseBatchFile(const char* filename, Batch* batch, bool alternative = false, bool strict = false,
+                        std::size_t nbThread = 0) const;
+
+    /**
+     * @brief Copy the parsed state of the arguments of Argparsor in the shared block of snapshot
+     *
+     * @param snapshot
+     */
+    void snapshot(Snapshot* snapshot) const;
+
+    /**
+     * @brief Copy the parsed state of result in the shared block of snapshot
+     *
+     * @param result
+     * @param snapshot
+     */
+    void snapshot(const Result& result, Snapshot* snapshot) const;
+
+    void addArgument(const std::vector<std::string>& nameOrFlags, const char* actionOrDefault = NULL,
+                     const char* help = NULL, bool isRequired = false, const char* argsHelp = NULL,
+                     std::size_t nbArgs = 0, const std::vector<std::string>& defaultArgs = std::vector<std::string>());
 
-      private:
+    /**
+     * @brief add argument
+     *
+     * @param nameOrFlags separate by space or comma
+     * @param actionOrDefault action list [store_true, store_false, append, extend, version]
+     * @param help
+     * @param isRequired
+     * @param argsHelp
+     * @param nbArgs
+     * @param nbDefaultArgs
+     * @param ...
+     */
+    void addArgument(const char* nameOrFlags, const char* actionOrDefault = NULL, const char* help = NULL,
+                     bool isRequired = false, const char* argsHelp = NULL, std::size_t nbArgs = 0,
+                     std::size_t nbDefaultArgs = 0, ...);
 
+    std::string dump();
 
+    /**
+     * @brief Format of serialize
+     */
+    enum Format {
+        JSON_FORMAT = 0,
+        BINARY_FORMAT
     };
 
     /**
-     * @brief Construct a new Argparsor object
+     * @brief Write the parsed state of the arguments of Argparsor in buffer without writing after size.
+     *
+     * @param buffer
+     * @param size
+     * @param format JSON_FORMAT or BINARY_FORMAT (length-prefixed)
+     * @return std::size_t size of the serialized state (can be greater than size like snprintf)
      */
-    Argparsor();
+    std::size_t serialize(char* buffer, std::size_t size, Format format = JSON_FORMAT) const;
 
     /**
-     * @brief Destroy the Argparsor object
+     * @brief Write the parsed state of result in buffer without writing after size.
+     *
+     * @param result
+     * @param buffer
+     * @param size
+     * @param format JSON_FORMAT or BINARY_FORMAT (length-prefixed)
+     * @return std::size_t size of the serialized state (can be greater than size like snprintf)
      */
-    ~Argparsor();
+    std::size_t serialize(const Result& result, char* buffer, std::size_t size, Format format = JSON_FORMAT) const;
 
     /**
-     * @brief Get the bynary name
+     * @brief Rebuild in result a state of serialize without parse (the format is detected).
+     *        The arguments not serialized have their default values
      *
-     * @return const std::string&
+     * @param buffer
+     * @param size
+     * @param result
      */
-    inline const std::string& getBynaryName() const {
-        return _binaryName;
-    }
+    void deserialize(const char* buffer, std::size_t size, Result* result) const;
+
+  private:
+
+    // arguments are referenced by the indexes and by the parse results
+    Argparsor(const Argparsor&);
+    Argparsor& operator=(const Argparsor&);
+
+    // mutex of pthread defined in the source file
+    class Mutex;
+
+    // argument classified by TokenStream
+    struct Token;
+
+    // arguments of argv and of response files classified during the parse
+    class TokenStream;
+
+    // output of serialize in a buffer of fixed size
+    class BufferOutput;
+
+    // readers of the formats of serialize
+    class BinaryReader;
+    class JsonReader;
 
     /**
-     * @brief Get the usage object
+     * @brief Value waiting the end of parse for go to arena
+     */
+    struct PendingValue {
+        PendingValue(ParsedArgument* argument_, const Value& value_) :
+            argument(argument_), clearCount(argument_->_clearCount), value(value_) {}
+        ParsedArgument* argument;
+        std::size_t clearCount;
+        Value value;
+    };
+
+    /**
+     * @brief State of one parse
+     */
+    struct ParseContext {
+        ParseContext(ParsedArgument* arguments_, std::vector<Value>* values_,
+                     std::vector<std::string>* additionalArguments_, std::list<std::string>* copies_,
+                     std::vector<std::pair<void*, std::size_t> >* mappedFiles_, bool zeroCopy_) :
+            arguments(arguments_),
+            values(values_),
+            pendingValues(),
+            additionalArguments(additionalArguments_),
+            additionalArgumentCallback(NULL),
+            additionalArgumentData(NULL),
+            positionalCursor(0),
+            exitOnHelp(true),
+            isBatch(false),
+            useEnvironment(true),
+            useConfigFile(true),
+            isExternal(),
+            subcommandName(NULL),
+            result(NULL),
+            copies(copies_),
+            mappedFiles(mappedFiles_),
+            zeroCopy(zeroCopy_) {}
+
+        /**
+         * @brief Get the parsed argument of argument in this parse
+         *
+         * @param argument
+         * @return ParsedArgument*
+         */
+        inline ParsedArgument* state(const Argument* argument) const {
+            if (arguments == NULL) {
+                // parseArguments keep the values in the arguments
+                return const_cast<Argument*>(argument);
+            }
+            return &arguments[argument->_index];
+        }
+
+        // parsed arguments by index or NULL for use the arguments
+        ParsedArgument* arguments;
+        // contiguous values of all arguments
+        std::vector<Value>* values;
+        std::vector<PendingValue> pendingValues;
+        std::vector<std::string>* additionalArguments;
+        // called for each additional argument instead of push in additionalArguments
+        AdditionalArgumentCallback additionalArgumentCallback;
+        void* additionalArgumentData;
+        // next positional argument to check
+        std::size_t positionalCursor;
+        // write usage and exit if help option is found
+        bool exitOnHelp;
+        // parse of parseBatch
+        bool isBatch;
+        // use the environment variables of arguments not found
+        bool useEnvironment;
+        // use the configuration file of arguments not found
+        bool useConfigFile;
+        // arguments set by argv or by an environment variable by index (a boolean can be set to false),
+        // the configuration file does not change them
+        std::vector<char> isExternal;
+        // name of subcommand found
+        std::string* subcommandName;
+        // result of parse or NULL for parseArguments
+        Result* result;
+        // storage of copies of arguments and of response files
+        std::list<std::string>* copies;
+        // response files mapped when zero copy is enabled
+        std::vector<std::pair<void*, std::size_t> >* mappedFiles;
+        bool zeroCopy;
+    };
+
+    /**
+     * @brief Parse arguments in result
      *
-     * @param oss
-     * @return std::ostream&
+     * @param argc
+     * @param argv
+     * @param result
+     * @param alternative
+     * @param strict
+     * @param batch parse of parseBatch: zero copy, no exit on help and no additional argument callback
      */
-    std::ostream& getUsage(std::ostream& oss = std::cout);
+    void parseResult(int argc, char* argv[], Result* result, bool alternative, bool strict, bool batch) const;
 
     /**
-     * @brief Get the argument object
+     * @brief Clear result and create a parsed argument by argument
      *
-     * @param str
-     * @return const Argument&
+     * @param result
      */
-    inline const Argument& getOption(const char* str) const {
-        std::map<std::string, Argument*>::const_iterator cit = _argumentFromName.find(str);
-        if (cit == _argumentFromName.end()) {
-            throw AccessDeniedException(str, "option not found");
-        }
-        return *(cit->second);
-    }
+    void initResult(Result* result) const;
 
     /**
-     * @brief Get the argument object
+     * @brief Write the state of arguments in buffer
      *
-     * @param str
-     * @return const Argument&
+     * @param binaryName
+     * @param states parsed arguments by index or NULL for use the arguments
+     * @param additionalArguments
+     * @param buffer
+     * @param size
+     * @param format
+     * @return std::size_t size of the serialized state
      */
-    inline const Argument& getOption(const std::string& str) const {
-        return getOption(str.c_str());
-    }
+    std::size_t serializeState(const std::string& binaryName, const ParsedArgument* states,
+                               const std::vector<std::string>& additionalArguments, char* buffer, std::size_t size,
+                               Format format) const;
 
     /**
-     * @brief Override bracket operator with getOption
+     * @brief Copy the state of arguments in the shared block of snapshot
      *
-     * @param str
-     * @return const Argument&
+     * @param binaryName
+     * @param states parsed arguments by index or NULL for use the arguments
+     * @param additionalArguments
+     * @param snapshot
      */
-    inline const Argument& operator[](const char* str) const {
-        return getOption(str);
-    }
+    void snapshotState(const std::string& binaryName, const ParsedArgument* states,
+                       const std::vector<std::string>& additionalArguments, Snapshot* snapshot) const;
 
     /**
-     * @brief Override bracket operator with getOption
+     * @brief Get the parsed argument of a serialized argument and remove its values
      *
-     * @param str
-     * @return const Argument&
+     * @param context
+     * @param name
+     * @param nameSize
+     * @param type serialized type must be the type of argument
+     * @return ParsedArgument*
      */
-    inline const Argument& operator[](const std::string& str) const {
-        return getOption(str);
-    }
+    ParsedArgument* deserializeArgument(ParseContext* context, const char* name, std::size_t nameSize,
+                                        enum ParsedArgument::Type type) const;
 
     /**
-     * @brief Get the vector of additional argument
+     * @brief Rebuild the state of BINARY_FORMAT
      *
-     * @return const std::vector<std::string>&
+     * @param context
+     * @param buffer
+     * @param size
+     * @param result
      */
-    inline const std::vector<std::string>& getAdditionalArguments() const {
-        return _additionalArguments;
-    }
+    void deserializeBinary(ParseContext* context, const char* buffer, std::size_t size, Result* result) const;
 
     /**
-     * @brief Set the usage message
+     * @brief Rebuild the state of JSON_FORMAT
      *
-     * @param usage
+     * @param context
+     * @param buffer
+     * @param size
+     * @param result
      */
-    inline void setUsage(const char* usage) {
-        _usage = usage;
-    }
+    void deserializeJson(ParseContext* context, const char* buffer, std::size_t size, Result* result) const;
 
     /**
-     * @brief Set the description in usage message
+     * @brief Parse the command line at index of batch and keep its error
      *
-     * @param description
+     * @param batch
+     * @param index
+     * @param line
+     * @param size
+     * @param alternative
+     * @param strict
      */
-    inline void setDescription(const char* description) {
-        _description = description;
-    }
+    void parseBatchLine(Batch* batch, std::size_t index, const char* line, std::size_t size, bool alternative,
+                        bool strict) const;
+
+    // state of a thread of parseBatch
+    struct BatchWorker;
 
     /**
-     * @brief Set the epilog in usage message
+     * @brief Parse the lines of batch of worker and steal the lines of other workers
      *
-     * @param epilog
+     * @param data BatchWorker
+     * @return void* NULL
      */
-    inline void setEpilog(const char* epilog) {
-        _epilog = epilog;
-    }
+    static void* batchWorker(void* data);
 
     /**
-     * @brief Parse arguments
+     * @brief Parse the arguments in context
      *
+     * @param context
      * @param argc
      * @param argv
      * @param alternative
      * @param strict
      */
-    void parseArguments(int argc, char* argv[], bool alternative = false, bool strict = false);
-
-    void addArgument(const std::vector<std::string>& nameOrFlags, const char* actionOrDefault = NULL,
-                     const char* help = NULL, bool isRequired = false, const char* argsHelp = NULL,
-                     std::size_t nbArgs = 0, const std::vector<std::string>& defaultArgs = std::vector<std::string>());
+    void parse(ParseContext* context, int argc, char* argv[], bool alternative, bool strict) const;
 
     /**
-     * @brief add argument
+     * @brief Write the usage message
      *
-     * @param nameOrFlags separate by space or comma
-     * @param actionOrDefault action list [store_true, store_false, append, extend, version]
-     * @param help
-     * @param isRequired
-     * @param argsHelp
-     * @param nbArgs
-     * @param nbDefaultArgs
-     * @param ...
+     * @param output
+     * @param binaryName
      */
-    void addArgument(const char* nameOrFlags, const char* actionOrDefault = NULL, const char* help = NULL,
-                     bool isRequired = false, const char* argsHelp = NULL, std::size_t nbArgs = 0,
-                     std::size_t nbDefaultArgs = 0, ...);
-
-    std::string dump();
+    void writeUsage(Output& output, const std::string& binaryName) const;
 
-  private:
+    /**
+     * @brief Render the usage message after the binary name
+     *
+     * @param oss
+     */
+    void renderUsage(std::ostream& oss) const;
 
     /**
      * @brief Get the short argument decompose multi short argument
      *
-     * @param maxIndex
-     * @param argv
-     * @param index
-     * @param alternative
+     * @param context
+     * @param stream
      */
-    void parseShortArgument(int maxIndex, char* argv[], int* index, bool alternative);
+    void parseShortArgument(ParseContext* context, TokenStream* stream) const;
 
     /**
      * @brief Get the long argument
      *
-     * @param maxIndex
-     * @param argv
-     * @param index
+     * @param context
+     * @param stream
+     */
+    void parseLongArgument(ParseContext* context, TokenStream* stream) const;
+
+    /**
+     * @brief Get the argument and its values from stream
+     *
+     * @param context
+     * @param stream
+     * @param token token of option already taken from stream
+     * @param option name of option for exception message
+     * @param optionSize
+     * @param argument
+     */
+    void parseArgument(ParseContext* context, TokenStream* stream, const Token& token, const char* option,
+                       std::size_t optionSize, Argument* argument) const;
+
+    /**
+     * @brief Set the arguments not found by the parse from environment in one pass on environ
+     *
+     * @param context
+     */
+    void parseEnvironment(ParseContext* context) const;
+
+    /**
+     * @brief Parse all next arguments of stream with the argparsor of subcommand of current token
+     *
+     * @param context
+     * @param stream
+     * @param binaryName
      * @param alternative
+     * @param strict
      */
-    void parseLongArgument(int maxIndex, char* argv[], int* index, bool alternative);
+    void parseSubcommand(ParseContext* context, TokenStream* stream, const char* binaryName, bool alternative,
+                         bool strict) const;
 
     /**
-     * @brief Get the argument
+     * @brief Set the arguments not found by the parse and not found in environment from the configuration file
      *
-     * @param maxIndex
-     * @param argv
-     * @param index
-     * @param hasArg
+     * @param context
+     */
+    void parseConfigFile(ParseContext* context) const;
+
+    /**
+     * @brief Set the argument from a value of environment or of configuration file
+     *
+     * @param context
      * @param option
-     * @param arg
+     * @param optionSize
+     * @param value view stored during the parse or NULL if there is not value
+     * @param size
      * @param argument
-     * @param alternative
      */
-    void parseArgument(int maxIndex, char* argv[], int* index, bool hasArg, const char* option, const char* arg,
-                       Argument* argument, bool alternative);
+    void parseValueArgument(ParseContext* context, const char* option, std::size_t optionSize, const char* value,
+                            std::size_t size, Argument* argument) const;
 
     /**
-     * @brief Get the positionnal argument
+     * @brief Map the file, the data is the mapped file if zero copy is enabled else one copy of file.
+     *        A file which is not regular (pipe, fifo, /dev/stdin) is read in one copy
      *
-     * @param argv
-     * @param index
-     * @param strict
+     * @param context
+     * @param filename
+     * @param data
+     * @param size
      */
-    void parsePositionnalArgument(char* argv[], int* index, bool strict);
+    void loadFile(ParseContext* context, const std::string& filename, const char** data, std::size_t* size) const;
 
     /**
-     * @brief Check end of infinite parsing
+     * @brief Remove the values of argument for the current parse
      *
      * @param argument
-     * @param alternative
-     * @return true
-     * @return false
      */
-    bool endOfInfiniteArgument(const char* argument, bool alternative);
+    static inline void clearValues(ParsedArgument* argument) {
+        ++argument->_clearCount;
+    }
+
+    /**
+     * @brief Add a value at argument for the current parse
+     *
+     * @param context
+     * @param argument
+     * @param value
+     * @param size
+     */
+    static inline void pushValue(ParseContext* context, ParsedArgument* argument, const char* value,
+                                 std::size_t size) {
+        context->pendingValues.push_back(PendingValue(argument, Value(value, size)));
+    }
+
+    /**
+     * @brief Move the values of current parse in the arena
+     *
+     * @param context
+     */
+    void commitValues(ParseContext* context) const;
+
+    /**
+     * @brief Remove the parsed values of arguments and set the default values
+     *
+     * @param context
+     */
+    void resetArguments(ParseContext* context) const;
+
+    /**
+     * @brief Set the default arguments of argument in arena
+     *
+     * @param argument
+     * @param defaultArgs
+     */
+    void setDefaultArguments(Argument* argument, const std::vector<std::string>& defaultArgs);
+
+    /**
+     * @brief Get the next positional argument not used by the parse
+     *
+     * @param context
+     * @return Argument* or NULL if all positional arguments are used
+     */
+    Argument* nextPositionalArgument(ParseContext* context) const;
+
+    /**
+     * @brief Get the positionnal argument
+     *
+     * @param context
+     * @param argument
+     * @param size
+     * @param nbRemaining number of arguments not parsed including this one
+     * @param strict
+     */
+    void parsePositionnalArgument(ParseContext* context, const char* argument, std::size_t size,
+                                  std::size_t nbRemaining, bool strict) const;
+
+    /**
+     * @brief Open addressing hash table of flag names with cached hashes
+     */
+    class FlagIndex {
+
+      public:
+
+        /**
+         * @brief Construct a new empty FlagIndex object
+         */
+        FlagIndex();
+
+        /**
+         * @brief Get the argument of name
+         *
+         * @param name
+         * @param size
+         * @return Argument* or NULL if not found
+         */
+        inline Argument* find(const char* name, std::size_t size) const {
+            return find("", 0, name, size);
+        }
+
+        /**
+         * @brief Get the argument of name prefixed by prefix without concatenate them
+         *
+         * @param prefix
+         * @param prefixSize
+         * @param name
+         * @param size
+         * @return Argument* or NULL if not found
+         */
+        Argument* find(const char* prefix, std::size_t prefixSize, const char* name, std::size_t size) const;
+
+        /**
+         * @brief Get the argument of name
+         *
+         * @param name
+         * @return Argument* or NULL if not found
+         */
+        inline Argument* find(const std::string& name) const {
+            return find(name.c_str(), name.size());
+        }
+
+        /**
+         * @brief Insert a new name, name must not already exist
+         *
+         * @param name
+         * @param argument
+         */
+        void insert(const std::string& name, Argument* argument);
+
+        /**
+         * @brief Remove all names of argument
+         *
+         * @param argument
+         */
+        void erase(const Argument* argument);
+
+        inline bool empty() const {
+            return _size == 0;
+        }
+
+      private:
+
+        struct Slot {
+            Slot() : hash(0), name(), argument(NULL) {}
+            std::size_t hash;
+            std::string name;
+            Argument* argument;
+        };
+
+        void rehash(std::size_t capacity);
+
+        std::vector<Slot> _slots;
+        std::size_t _size;
+    };
 
     std::string _binaryName;
 
     std::list<Argument> _arguments;
-    std::map<std::string, Argument*> _argumentFromName;
+    FlagIndex _argumentFromName;
+    // arguments by name of environment variable
+    FlagIndex _argumentFromEnvironment;
+    // direct access of short flag by character
+    Argument* _argumentFromShortName[256];
+
+    /**
+     * @brief Subcommand added by addSubcommand
+     */
+    struct Subcommand {
+        std::string name;
+        std::string help;
+        SubcommandBuilder builder;
+        void* data;
+        std::size_t hash;
+        // arguments of subcommand or NULL if not built
+        Argparsor* argparsor;
+    };
+
+    /**
+     * @brief Get the subcommand of name
+     *
+     * @param name
+     * @param size
+     * @return Subcommand* or NULL if not found
+     */
+    Subcommand* findSubcommand(const char* name, std::size_t size) const;
+
+    /**
+     * @brief Insert the subcommand in the hash table of subcommands
+     *
+     * @param subcommand
+     */
+    void insertSubcommand(Subcommand* subcommand);
+
+    /**
+     * @brief Get the argparsor of subcommand, call its builder at the first call
+     *
+     * @param subcommand
+     * @return Argparsor*
+     */
+    Argparsor* buildSubcommand(Subcommand* subcommand) const;
+
+    // subcommands in order of declaration
+    std::list<Subcommand> _subcommands;
+    // open addressing hash table of subcommands
+    std::vector<Subcommand*> _subcommandSlots;
+    // subcommand found by parseArguments
+    std::string _subcommandName;
+    Mutex* _subcommandMutex;
 
     Argument* _helpOption;
 
+    // positional arguments in order of declaration
+    std::vector<Argument*> _positionalArguments;
+    // index of next argument created
+    std::size_t _nextArgumentIndex;
+
     std::string _usage;
     std::string _description;
     std::string _epilog;
+    // usage rendered after the binary name until a modification of arguments
+    mutable std::string _usageCache;
+    mutable bool _isUsageCached;
+    Mutex* _usageMutex;
+
+    bool _zeroCopy;
+    std::string _fromFilePrefixChars;
+    std::string _configFile;
+    AdditionalArgumentCallback _additionalArgumentCallback;
+    void* _additionalArgumentData;
+
+    // contiguous values of all arguments
+    std::vector<Value> _values;
+    // copies of argv when zero copy is disabled
+    std::list<std::string> _argvCopies;
+    // address and size of response files mapped when zero copy is enabled
+    std::vector<std::pair<void*, std::size_t> > _mappedFiles;
 
     std::vector<std::string> _additionalArguments;
 };
 
+template<typename T>
+char Argparsor::ParsedArgument::CacheTag<T>::tag = 0;
+
 } // namespace mblet
 
 #endif // _MBLET_ARGPARSOR_HPP_
\ No newline at end of file
@@ -26,9 +26,13 @@
 #ifndef _MBLET_STRTO_HPP_
 #define _MBLET_STRTO_HPP_
 
-#include <string>
-#include <map>
+#include <cerrno>
+#include <clocale>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
 
 namespace mblet {
 
@@ -82,82 +86,585 @@ class StrToException : public std::exception {
 };
 
 /**
- * @brief transform string to number strict
+ * @brief exception of strto function when the value is out of range of type
+ */
+class StrToOverflowException : public StrToException {
+  public:
+    /**
+     * @brief Construct a new Str To Overflow Exception object
+     *
+     * @param value
+     * @param type
+     */
+    StrToOverflowException(const std::string& value, const char* type) : StrToException(value, type) {
+        _what += ": out of range";
+    }
+    /**
+     * @brief Destroy the Str To Overflow Exception object
+     */
+    virtual ~StrToOverflowException() throw() {}
+};
+
+namespace strtodetail {
+
+/**
+ * @brief Get the value of a digit in base 2, 8, 10 or 16
  *
- * @tparam T
- * @param str
- * @return T
+ * @param c
+ * @return unsigned int digit or 16 if c is not a digit
  */
-template<typename T>
-inline T strto(const std::string& str) {
-    T ret;
-    std::stringstream stringStream("");
-    std::size_t index = 0;
+inline unsigned int digitValue(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    else if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    else if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return 16;
+}
+
+/**
+ * @brief Check if number has a decimal point or an exponent
+ *
+ * @param it
+ * @param end
+ * @return true if number is a floating number
+ */
+inline bool isFloatingNumber(const char* it, const char* end) {
+    for (; it != end ; ++it) {
+        if (*it == '.' || *it == 'e' || *it == 'E') {
+            return true;
+        }
+    }
+    return false;
+}
 
-    if (str[index] == '-' || str[index] == '+') {
-        ++index;
+/**
+ * @brief Convert with a stringstream (other types)
+ *
+ * @tparam T
+ * @tparam isInteger
+ */
+template<typename T, bool isInteger = std::numeric_limits<T>::is_integer>
+struct StrTo {
+    static T convert(const char* str, std::size_t size) {
+        return convert(std::string(str, size));
     }
-    // is hex
-    if (str[index] == '0' && (str[index + 1] == 'x' || str[index + 1] == 'X')) {
-        ++index;
-        ++index;
-        while (str[index] != '\0') {
-            if (str[index] >= '0' && str[index] <= '9') {
-                ++index;
+
+    static T convert(const std::string& str) {
+        T ret;
+        std::stringstream stringStream("");
+        std::size_t index = 0;
+
+        if (str[index] == '-' || str[index] == '+') {
+            ++index;
+        }
+        // is hex
+        if (str[index] == '0' && (str[index + 1] == 'x' || str[index + 1] == 'X')) {
+            ++index;
+            ++index;
+            while (str[index] != '\0') {
+                if (str[index] >= '0' && str[index] <= '9') {
+                    ++index;
+                }
+                else if (str[index] >= 'a' && str[index] <= 'f') {
+                    ++index;
+                }
+                else if (str[index] >= 'A' && str[index] <= 'F') {
+                    ++index;
+                }
+                else {
+                    throw StrToException(str, "hex number");
+                }
             }
-            else if (str[index] >= 'a' && str[index] <= 'f') {
-                ++index;
+            stringStream << strtoll(str.c_str(), NULL, 16);
+        }
+        // is binary
+        else if (str[index] == '0' && (str[index + 1] == 'b' || str[index + 1] == 'B')) {
+            ++index;
+            ++index;
+            std::size_t start = index;
+            while (str[index] != '\0') {
+                if (str[index] == '0' || str[index] == '1') {
+                    ++index;
+                }
+                else {
+                    throw StrToException(str, "binnary number");
+                }
             }
-            else if (str[index] >= 'A' && str[index] <= 'F') {
-                ++index;
+            stringStream << strtoull(str.c_str() + start, NULL, 2);
+        }
+        // is octal
+        else if (str[index] == '0' && str.find('.') == std::string::npos && str.find('e') == std::string::npos
+                 && str.find('E') == std::string::npos) {
+            while (str[index] != '\0') {
+                if (str[index] >= '0' && str[index] <= '9') {
+                    ++index;
+                }
+                else {
+                    throw StrToException(str, "octal number");
+                }
             }
-            else {
-                throw StrToException(str, "hex number");
+            stringStream << strtoll(str.c_str(), NULL, 8);
+        }
+        else {
+            char* endPtr = NULL;
+            stringStream << strtod(str.c_str(), &endPtr);
+            if (endPtr != NULL && endPtr[0] != '\0') {
+                throw StrToException(str, "number");
             }
         }
-        stringStream << strtoll(str.c_str(), NULL, 16);
+        if (stringStream >> ret) {
+            return ret;
+        }
+        else {
+            throw StrToException(str, "number");
+        }
     }
-    // is binary
-    else if (str[index] == '0' && (str[index + 1] == 'b' || str[index + 1] == 'B')) {
-        ++index;
-        ++index;
-        std::size_t start = index;
-        while (str[index] != '\0') {
-            if (str[index] == '0' || str[index] == '1') {
-                ++index;
+};
+
+/**
+ * @brief Convert without allocation (integral types).
+ *        Throw a StrToOverflowException if the value is out of range of T
+ *
+ * @tparam T
+ */
+template<typename T>
+struct StrTo<T, true> {
+    static T convert(const std::string& str) {
+        return convert(str.c_str(), str.size());
+    }
+
+    static T convert(const char* str, std::size_t size) {
+        const char* it = str;
+        const char* end = it + size;
+        bool isNegative = false;
+
+        if (it != end && (*it == '-' || *it == '+')) {
+            isNegative = (*it == '-');
+            ++it;
+        }
+        unsigned int base = 10;
+        const char* type = "number";
+        // is hex
+        if (end - it > 1 && it[0] == '0' && (it[1] == 'x' || it[1] == 'X')) {
+            base = 16;
+            type = "hex number";
+            it += 2;
+        }
+        // is binary
+        else if (end - it > 1 && it[0] == '0' && (it[1] == 'b' || it[1] == 'B')) {
+            base = 2;
+            type = "binnary number";
+            it += 2;
+        }
+        else if (isFloatingNumber(it, end)) {
+            return convertFloating(std::string(str, size));
+        }
+        // is octal
+        else if (end - it > 1 && it[0] == '0') {
+            base = 8;
+            type = "octal number";
+        }
+        if (it == end) {
+            throw StrToException(std::string(str, size), type);
+        }
+        const T tBase = static_cast<T>(base);
+        const T min = std::numeric_limits<T>::min();
+        const T max = std::numeric_limits<T>::max();
+        T ret = 0;
+        for (; it != end ; ++it) {
+            unsigned int digit = digitValue(*it);
+            if (digit >= base) {
+                throw StrToException(std::string(str, size), type);
+            }
+            if (isNegative) {
+                // accumulate in negative for the min of signed types
+                if ((!std::numeric_limits<T>::is_signed && digit != 0)
+                    || ret < static_cast<T>((min + static_cast<T>(digit)) / tBase)) {
+                    throw StrToOverflowException(std::string(str, size), type);
+                }
+                ret = static_cast<T>(ret * tBase - static_cast<T>(digit));
             }
             else {
-                throw StrToException(str, "binnary number");
+                if (ret > static_cast<T>((max - static_cast<T>(digit)) / tBase)) {
+                    throw StrToOverflowException(std::string(str, size), type);
+                }
+                ret = static_cast<T>(ret * tBase + static_cast<T>(digit));
             }
         }
-        stringStream << strtoull(str.c_str() + start, NULL, 2);
+        return ret;
+    }
+
+    /**
+     * @brief Convert a number with decimal point or exponent as "1e3"
+     *
+     * @param str
+     * @return T
+     */
+    static T convertFloating(const std::string& str) {
+        char* endPtr = NULL;
+        double value = strtod(str.c_str(), &endPtr);
+        if (endPtr != str.c_str() + str.size()) {
+            throw StrToException(str, "number");
+        }
+        // bounds are power of 2 so exact in double
+        const double min = static_cast<double>(std::numeric_limits<T>::min());
+        const double maxExcluded = (static_cast<double>(std::numeric_limits<T>::max() / 2) + 1.0) * 2.0;
+        if (!(value >= min && value < maxExcluded)) {
+            throw StrToOverflowException(str, "number");
+        }
+        T ret = static_cast<T>(value);
+        if (static_cast<double>(ret) != value) {
+            throw StrToException(str, "number");
+        }
+        return ret;
+    }
+};
+
+/**
+ * @brief Limits of the exact conversion of a decimal number: a mantissa of MAX_DIGITS digits and a power of ten
+ *        lower or equal than 10^MAX_EXPONENT are exact in T, so their product or quotient is correctly rounded
+ *
+ * @tparam T
+ */
+template<typename T>
+struct FastPathLimits;
+
+template<>
+struct FastPathLimits<float> {
+    enum {
+        MAX_DIGITS = 7,
+        MAX_EXPONENT = 10
+    };
+};
+
+template<>
+struct FastPathLimits<double> {
+    enum {
+        MAX_DIGITS = 15,
+        MAX_EXPONENT = 22
+    };
+};
+
+/**
+ * @brief Convert with the function of C library of T (strtof or strtod) for round only one time
+ *
+ * @tparam T
+ * @param str
+ * @return T
+ */
+template<typename T>
+inline T cStrto(const char* str);
+
+template<>
+inline float cStrto<float>(const char* str) {
+    return strtof(str, NULL);
+}
+
+template<>
+inline double cStrto<double>(const char* str) {
+    return strtod(str, NULL);
+}
+
+/**
+ * @brief Convert with strtof or strtod independently of the decimal point of locale
+ *
+ * @tparam T
+ * @param str
+ * @return T
+ */
+template<typename T>
+inline T localeIndependentStrto(const std::string& str) {
+    const char decimalPoint = localeconv()->decimal_point[0];
+    if (decimalPoint == '.' || str.find('.') == std::string::npos) {
+        return cStrto<T>(str.c_str());
+    }
+    std::string localeStr(str);
+    localeStr[localeStr.find('.')] = decimalPoint;
+    return cStrto<T>(localeStr.c_str());
+}
+
+/**
+ * @brief Convert a floating number without allocation when the mantissa and the exponent are small enough for an
+ *        exact conversion (Clinger), else with strtof for float and strtod for double.
+ *        Hex, binary and octal integers are accepted as in the integral types.
+ *        Throw a StrToOverflowException if the value is out of range of T
+ *
+ * @tparam T float or double
+ * @param str
+ * @param size
+ * @return T
+ */
+template<typename T>
+inline T convertFloating(const char* str, std::size_t size) {
+    static const T powersOfTen[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+        1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const int maxDigits = FastPathLimits<T>::MAX_DIGITS;
+    const int maxExponent = FastPathLimits<T>::MAX_EXPONENT;
+    const char* it = str;
+    const char* end = it + size;
+    bool isNegative = false;
+
+    if (it != end && (*it == '-' || *it == '+')) {
+        isNegative = (*it == '-');
+        ++it;
+    }
+    unsigned int base = 10;
+    const char* type = "number";
+    // is hex
+    if (end - it > 1 && it[0] == '0' && (it[1] == 'x' || it[1] == 'X')) {
+        base = 16;
+        type = "hex number";
+        it += 2;
+    }
+    // is binary
+    else if (end - it > 1 && it[0] == '0' && (it[1] == 'b' || it[1] == 'B')) {
+        base = 2;
+        type = "binnary number";
+        it += 2;
     }
     // is octal
-    else if (str[index] == '0' && str.find('.') == std::string::npos && str.find('e') == std::string::npos
-             && str.find('E') == std::string::npos) {
-        while (str[index] != '\0') {
-            if (str[index] >= '0' && str[index] <= '9') {
-                ++index;
+    else if (end - it > 1 && it[0] == '0' && !isFloatingNumber(it, end)) {
+        base = 8;
+        type = "octal number";
+    }
+    if (base != 10) {
+        if (it == end) {
+            throw StrToException(std::string(str, size), type);
+        }
+        T ret = 0;
+        for (; it != end ; ++it) {
+            unsigned int digit = digitValue(*it);
+            if (digit >= base) {
+                throw StrToException(std::string(str, size), type);
             }
-            else {
-                throw StrToException(str, "octal number");
+            ret = ret * static_cast<T>(base) + static_cast<T>(digit);
+        }
+        if (ret > std::numeric_limits<T>::max()) {
+            throw StrToOverflowException(std::string(str, size), type);
+        }
+        return isNegative ? -ret : ret;
+    }
+
+    // mantissa of maxDigits significant digits at most
+    T mantissa = 0;
+    int nbDigits = 0;
+    int exponent = 0;
+    bool hasDigit = false;
+    bool isExact = true;
+    bool isFraction = false;
+    for (; it != end ; ++it) {
+        if (*it == '.' && !isFraction) {
+            isFraction = true;
+            continue;
+        }
+        if (*it < '0' || *it > '9') {
+            break;
+        }
+        hasDigit = true;
+        if (nbDigits < maxDigits) {
+            if (nbDigits > 0 || *it != '0') {
+                mantissa = mantissa * 10 + static_cast<T>(*it - '0');
+                ++nbDigits;
             }
+            if (isFraction) {
+                --exponent;
+            }
+        }
+        else if (*it != '0') {
+            isExact = false;
+        }
+        else if (!isFraction) {
+            ++exponent;
         }
-        stringStream << strtoll(str.c_str(), NULL, 8);
     }
-    else {
-        char* endPtr = NULL;
-        stringStream << strtod(str.c_str(), &endPtr);
-        if (endPtr != NULL && endPtr[0] != '\0') {
-            throw StrToException(str, "number");
+    if (!hasDigit) {
+        throw StrToException(std::string(str, size), type);
+    }
+    if (it != end && (*it == 'e' || *it == 'E')) {
+        ++it;
+        bool isNegativeExponent = false;
+        if (it != end && (*it == '-' || *it == '+')) {
+            isNegativeExponent = (*it == '-');
+            ++it;
         }
+        if (it == end) {
+            throw StrToException(std::string(str, size), type);
+        }
+        int explicitExponent = 0;
+        for (; it != end && *it >= '0' && *it <= '9' ; ++it) {
+            // stay far from overflow of int, the value is 0 or infinite anyway
+            if (explicitExponent < 100000) {
+                explicitExponent = explicitExponent * 10 + (*it - '0');
+            }
+        }
+        exponent += isNegativeExponent ? -explicitExponent : explicitExponent;
     }
-    if (stringStream >> ret) {
-        return ret;
+    if (it != end) {
+        throw StrToException(std::string(str, size), type);
+    }
+
+    T ret;
+    if (mantissa == 0) {
+        ret = 0;
+    }
+    else if (isExact && exponent >= 0 && exponent <= maxExponent) {
+        ret = mantissa * powersOfTen[exponent];
+    }
+    else if (isExact && exponent < 0 && -exponent <= maxExponent) {
+        ret = mantissa / powersOfTen[-exponent];
+    }
+    else if (isExact && exponent > maxExponent && exponent - maxExponent <= maxDigits - nbDigits) {
+        // mantissa * 10^(exponent - maxExponent) keep less than maxDigits digits
+        ret = (mantissa * powersOfTen[exponent - maxExponent]) * powersOfTen[maxExponent];
     }
     else {
-        throw StrToException(str, "number");
+        errno = 0;
+        T value = localeIndependentStrto<T>(std::string(str, size));
+        // HUGE_VALF or HUGE_VAL
+        if (errno == ERANGE && (value > std::numeric_limits<T>::max() || value < -std::numeric_limits<T>::max())) {
+            throw StrToOverflowException(std::string(str, size), type);
+        }
+        return value;
     }
+    return isNegative ? -ret : ret;
+}
+
+/**
+ * @brief Convert a float without stringstream
+ */
+template<>
+struct StrTo<float, false> {
+    static float convert(const char* str, std::size_t size) {
+        return convertFloating<float>(str, size);
+    }
+
+    static float convert(const std::string& str) {
+        return convertFloating<float>(str.c_str(), str.size());
+    }
+};
+
+/**
+ * @brief Convert a double without stringstream
+ */
+template<>
+struct StrTo<double, false> {
+    static double convert(const char* str, std::size_t size) {
+        return convertFloating<double>(str, size);
+    }
+
+    static double convert(const std::string& str) {
+        return convertFloating<double>(str.c_str(), str.size());
+    }
+};
+
+} // namespace strtodetail
+
+/**
+ * @brief transform string to number strict
+ *
+ * @tparam T
+ * @param str
+ * @return T
+ */
+template<typename T>
+inline T strto(const std::string& str) {
+    return strtodetail::StrTo<T>::convert(str);
+}
+
+/**
+ * @brief transform buffer to number strict
+ *
+ * @tparam T
+ * @param str
+ * @param size
+ * @return T
+ */
+template<typename T>
+inline T strto(const char* str, std::size_t size) {
+    return strtodetail::StrTo<T>::convert(str, size);
+}
+
+namespace strtodetail {
+
+/**
+ * @brief Check if str is lower or upper or capitalized (as "yes", "YES" or "Yes")
+ *
+ * @param str
+ * @param size size of str, lower and upper
+ * @param lower
+ * @param upper
+ * @return true if str is a spelling of word
+ */
+inline bool isBoolSpelling(const char* str, std::size_t size, const char* lower, const char* upper) {
+    if (str[0] == lower[0]) {
+        return std::memcmp(str + 1, lower + 1, size - 1) == 0;
+    }
+    else if (str[0] == upper[0]) {
+        return std::memcmp(str + 1, lower + 1, size - 1) == 0 || std::memcmp(str + 1, upper + 1, size - 1) == 0;
+    }
+    return false;
+}
+
+} // namespace strtodetail
+
+/**
+ * @brief transform buffer to bool strict without allocation.
+ *        Accept "true", "on", "yes", "y", "1", "false", "off", "no", "n", "0" in lower, upper or capitalized
+ *
+ * @tparam bool
+ * @param str
+ * @param size
+ * @return true
+ * @return false
+ */
+template<>
+inline bool strto(const char* str, std::size_t size) {
+    switch (size) {
+        case 1:
+            if (str[0] == '1' || str[0] == 'y' || str[0] == 'Y') {
+                return true;
+            }
+            else if (str[0] == '0' || str[0] == 'n' || str[0] == 'N') {
+                return false;
+            }
+            break;
+        case 2:
+            if (strtodetail::isBoolSpelling(str, size, "on", "ON")) {
+                return true;
+            }
+            else if (strtodetail::isBoolSpelling(str, size, "no", "NO")) {
+                return false;
+            }
+            break;
+        case 3:
+            if (strtodetail::isBoolSpelling(str, size, "yes", "YES")) {
+                return true;
+            }
+            else if (strtodetail::isBoolSpelling(str, size, "off", "OFF")) {
+                return false;
+            }
+            break;
+        case 4:
+            if (strtodetail::isBoolSpelling(str, size, "true", "TRUE")) {
+                return true;
+            }
+            break;
+        case 5:
+            if (strtodetail::isBoolSpelling(str, size, "false", "FALSE")) {
+                return false;
+            }
+            break;
+        default:
+            break;
+    }
+    throw StrToException(std::string(str, size), "bool");
 }
 
 /**
@@ -170,44 +677,9 @@ inline T strto(const std::string& str) {
  */
 template<>
 inline bool strto(const std::string& str) {
-    static const std::pair<std::string, bool> pairStrToBool[] = {
-        std::pair<std::string, bool>("TRUE", true),
-        std::pair<std::string, bool>("True", true),
-        std::pair<std::string, bool>("true", true),
-        std::pair<std::string, bool>("ON", true),
-        std::pair<std::string, bool>("On", true),
-        std::pair<std::string, bool>("on", true),
-        std::pair<std::string, bool>("YES", true),
-        std::pair<std::string, bool>("Yes", true),
-        std::pair<std::string, bool>("yes", true),
-        std::pair<std::string, bool>("Y", true),
-        std::pair<std::string, bool>("y", true),
-        std::pair<std::string, bool>("1", true),
-        std::pair<std::string, bool>("FALSE", false),
-        std::pair<std::string, bool>("False", false),
-        std::pair<std::string, bool>("false", false),
-        std::pair<std::string, bool>("OFF", false),
-        std::pair<std::string, bool>("Off", false),
-        std::pair<std::string, bool>("off", false),
-        std::pair<std::string, bool>("NO", false),
-        std::pair<std::string, bool>("No", false),
-        std::pair<std::string, bool>("no", false),
-        std::pair<std::string, bool>("N", false),
-        std::pair<std::string, bool>("n", false),
-        std::pair<std::string, bool>("0", false)
-    };
-    static const std::map<std::string, bool> strToBool(pairStrToBool,
-                                                       pairStrToBool + sizeof(pairStrToBool) / sizeof(*pairStrToBool));
-
-    std::map<std::string, bool>::const_iterator cit = strToBool.find(str);
-    if (cit != strToBool.end()) {
-        return cit->second;
-    }
-    else {
-        throw StrToException(str, "bool");
-    }
+    return strto<bool>(str.c_str(), str.size());
 }
 
 } // namespace mblet
 
-#endif // _MBLET_STRTO_HPP_
\ No newline at end of file
+#endif // _MBLET_STRTO_HPP_
@@ -23,17 +23,32 @@
  * SOFTWARE.
  */
 
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
 #include <iostream>
+#include <fstream>
+#include <iterator>
 #include <cstdlib>
 #include <cstdarg>
+#include <cctype>
 #include <cstring>
+#include <cerrno>
 #include <algorithm>
+#include <deque>
 
 #include "argparsor.h"
 
 #define PREFIX_SIZEOF_SHORT_OPTION (sizeof("-") - 1)
 #define PREFIX_SIZEOF_LONG_OPTION (sizeof("--") - 1)
 
+// variables of environment of process
+extern char** environ;
+
 namespace mblet {
 
 /**
@@ -55,16 +70,15 @@ static inline bool isShortOption(const char* arg) {
 }
 
 /**
- * @brief arg is "--.*"
+ * @brief arg of size is "-[^-].*"
  *
  * @param arg
+ * @param size
  * @return true
  * @return false
  */
-static inline bool isLongOption(const char* arg) {
-    if (arg != NULL &&
-        arg[0] == '-' && arg[1] == '-' &&
-        arg[2] != '\0') {
+static inline bool isShortOption(const char* arg, std::size_t size) {
+    if (size >= 2 && arg[0] == '-' && arg[1] != '-') {
         return true;
     }
     else {
@@ -73,16 +87,15 @@ static inline bool isLongOption(const char* arg) {
 }
 
 /**
- * @brief arg is "--"
+ * @brief arg of size is "--.+"
  *
  * @param arg
+ * @param size
  * @return true
  * @return false
  */
-static inline bool isEndOption(const char* arg) {
-    if (arg != NULL &&
-        arg[0] == '-' && arg[1] == '-' &&
-        arg[2] == '\0') {
+static inline bool isLongOption(const char* arg, std::size_t size) {
+    if (size >= 3 && arg[0] == '-' && arg[1] == '-') {
         return true;
     }
     else {
@@ -91,45 +104,133 @@ static inline bool isEndOption(const char* arg) {
 }
 
 /**
- * @brief get index of en option index or argc
+ * @brief arg of size is "--"
  *
- * @param argc
- * @param argv
- * @return int
+ * @param arg
+ * @param size
+ * @return true
+ * @return false
  */
-static inline int endOptionIndex(int argc, char** argv) {
-    for (int i = 0 ; i < argc ; ++i) {
-        if (isEndOption(argv[i])) {
-            return i;
-        }
+static inline bool isEndOption(const char* arg, std::size_t size) {
+    if (size == 2 && arg[0] == '-' && arg[1] == '-') {
+        return true;
+    }
+    else {
+        return false;
     }
-    return argc;
 }
 
 /**
- * @brief split arg if contain '=' character
+ * @brief split arg of size if contain '=' character
  *
  * @param arg
- * @param retOptionName
- * @param retArgument
- * @return true
- * @return false
+ * @param size
+ * @param retOptionSize size of option name part
+ * @param retArgSize size of argument part
+ * @return const char* argument part after '=' or NULL
  */
-static inline bool takeArg(const char* arg, std::string* retOptionName, std::string* retArgument) {
-    char* equal = ::strchr(const_cast<char*>(arg), '=');
+static inline const char* takeArg(const char* arg, std::size_t size, std::size_t* retOptionSize,
+                                  std::size_t* retArgSize) {
+    const char* equal = static_cast<const char*>(::memchr(arg, '=', size));
     if (equal) {
-        std::string firstPart(arg, 0, equal - arg);
-        *retOptionName = firstPart;
-        std::string secondPart(arg, equal - arg + 1, std::string::npos);
-        *retArgument = secondPart;
+        *retOptionSize = equal - arg;
+        *retArgSize = size - *retOptionSize - 1;
+        return equal + 1;
+    }
+    else {
+        *retOptionSize = size;
+        *retArgSize = 0;
+        return NULL;
+    }
+}
+
+static inline bool isArgumentSeparator(char c) {
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f') {
         return true;
     }
     else {
-        *retOptionName = arg;
         return false;
     }
 }
 
+/**
+ * @brief Find the next argument of buffer separate by spaces, quoted by ' or " or escaped by '\\'
+ *
+ * @param buffer
+ * @param size
+ * @param position position in buffer, updated after the argument
+ * @param retArgument start of argument in buffer
+ * @param retSize size of argument in buffer
+ * @param retIsEscaped argument contains quotes or escapes and must be unescaped
+ * @return false if there is not more argument
+ */
+static bool nextArgument(const char* buffer, std::size_t size, std::size_t* position, const char** retArgument,
+                         std::size_t* retSize, bool* retIsEscaped) {
+    std::size_t i = *position;
+    while (i < size && isArgumentSeparator(buffer[i])) {
+        ++i;
+    }
+    if (i >= size) {
+        *position = i;
+        return false;
+    }
+    std::size_t start = i;
+    bool isEscaped = false;
+    char quote = '\0';
+    for ( ; i < size ; ++i) {
+        if (quote == '\0' && isArgumentSeparator(buffer[i])) {
+            break;
+        }
+        else if (quote == '\0' && (buffer[i] == '\'' || buffer[i] == '"')) {
+            quote = buffer[i];
+            isEscaped = true;
+        }
+        else if (quote != '\0' && buffer[i] == quote) {
+            quote = '\0';
+        }
+        else if (quote != '\'' && buffer[i] == '\\' && i + 1 < size) {
+            ++i;
+            isEscaped = true;
+        }
+    }
+    *position = i;
+    *retArgument = buffer + start;
+    *retSize = i - start;
+    *retIsEscaped = isEscaped;
+    return true;
+}
+
+/**
+ * @brief Append the argument without its quotes and escapes
+ *
+ * @param argument
+ * @param size
+ * @param ret
+ */
+static void unescapeArgument(const char* argument, std::size_t size, std::string* ret) {
+    char quote = '\0';
+    for (std::size_t i = 0 ; i < size ; ++i) {
+        if (quote == '\0' && (argument[i] == '\'' || argument[i] == '"')) {
+            quote = argument[i];
+        }
+        else if (quote != '\0' && argument[i] == quote) {
+            quote = '\0';
+        }
+        else if (quote != '\'' && argument[i] == '\\' && i + 1 < size) {
+            ++i;
+            ret->push_back(argument[i]);
+        }
+        else {
+            ret->push_back(argument[i]);
+        }
+    }
+}
+
+/**
+ * @brief Maximum depth of response files included by a response file
+ */
+static const std::size_t RESPONSE_FILE_MAX_DEPTH = 16;
+
 static inline bool isFlagCharacter(const char& c) {
     if (::isalnum(c) || c == '-' || c == '_') {
         return true;
@@ -158,25 +259,300 @@ static inline std::vector<std::string> splitFlags(const std::string& str) {
     return ret;
 }
 
-Argparsor::Argparsor() {
+/**
+ * @brief FNV-1a hash of name
+ *
+ * @param name
+ * @param size
+ * @param hash previous hash for continue
+ * @return std::size_t
+ */
+static inline std::size_t hashFlag(const char* name, std::size_t size, std::size_t hash = 2166136261u) {
+    for (std::size_t i = 0 ; i < size ; ++i) {
+        hash ^= static_cast<unsigned char>(name[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+Argparsor::FlagIndex::FlagIndex() :
+    _slots(),
+    _size(0)
+{}
+
+Argparsor::Argument* Argparsor::FlagIndex::find(const char* prefix, std::size_t prefixSize,
+                                                const char* name, std::size_t size) const {
+    if (_size == 0) {
+        return NULL;
+    }
+    const std::size_t mask = _slots.size() - 1;
+    const std::size_t hash = hashFlag(name, size, hashFlag(prefix, prefixSize));
+    for (std::size_t i = hash & mask ; _slots[i].argument != NULL ; i = (i + 1) & mask) {
+        const std::string& slotName = _slots[i].name;
+        if (_slots[i].hash == hash && slotName.size() == prefixSize + size &&
+            ::memcmp(slotName.c_str(), prefix, prefixSize) == 0 &&
+            ::memcmp(slotName.c_str() + prefixSize, name, size) == 0) {
+            return _slots[i].argument;
+        }
+    }
+    return NULL;
+}
+
+void Argparsor::FlagIndex::insert(const std::string& name, Argument* argument) {
+    // keep load factor under 1/2 for short probe sequences
+    if ((_size + 1) * 2 > _slots.size()) {
+        rehash(_slots.empty() ? 16 : _slots.size() * 2);
+    }
+    const std::size_t mask = _slots.size() - 1;
+    const std::size_t hash = hashFlag(name.c_str(), name.size());
+    std::size_t i = hash & mask;
+    while (_slots[i].argument != NULL) {
+        i = (i + 1) & mask;
+    }
+    _slots[i].hash = hash;
+    _slots[i].name = name;
+    _slots[i].argument = argument;
+    ++_size;
+}
+
+void Argparsor::FlagIndex::erase(const Argument* argument) {
+    // rebuild without argument for keep probe sequences valid
+    std::vector<Slot> slots;
+    slots.swap(_slots);
+    _size = 0;
+    for (std::size_t i = 0 ; i < slots.size() ; ++i) {
+        if (slots[i].argument != NULL && slots[i].argument != argument) {
+            insert(slots[i].name, slots[i].argument);
+        }
+    }
+}
+
+void Argparsor::FlagIndex::rehash(std::size_t capacity) {
+    std::vector<Slot> slots(capacity);
+    slots.swap(_slots);
+    const std::size_t mask = _slots.size() - 1;
+    for (std::size_t i = 0 ; i < slots.size() ; ++i) {
+        if (slots[i].argument != NULL) {
+            std::size_t j = slots[i].hash & mask;
+            while (_slots[j].argument != NULL) {
+                j = (j + 1) & mask;
+            }
+            _slots[j].hash = slots[i].hash;
+            _slots[j].name.swap(slots[i].name);
+            _slots[j].argument = slots[i].argument;
+        }
+    }
+}
+
+/**
+ * @brief Mutex of pthread, the public header does not include pthread.h
+ */
+class Argparsor::Mutex {
+
+  public:
+
+    Mutex() {
+        pthread_mutex_init(&_mutex, NULL);
+    }
+
+    ~Mutex() {
+        pthread_mutex_destroy(&_mutex);
+    }
+
+    void lock() {
+        pthread_mutex_lock(&_mutex);
+    }
+
+    void unlock() {
+        pthread_mutex_unlock(&_mutex);
+    }
+
+  private:
+
+    Mutex(const Mutex&);
+    Mutex& operator=(const Mutex&);
+
+    pthread_mutex_t _mutex;
+};
+
+Argparsor::Argparsor() :
+    _subcommands(),
+    _subcommandSlots(),
+    _subcommandName(),
+    _subcommandMutex(new Mutex()),
+    _helpOption(NULL),
+    _positionalArguments(),
+    _nextArgumentIndex(0),
+    _usageCache(),
+    _isUsageCached(false),
+    _usageMutex(new Mutex()),
+    _zeroCopy(false),
+    _fromFilePrefixChars(),
+    _configFile(),
+    _additionalArgumentCallback(NULL),
+    _additionalArgumentData(NULL) {
+    std::fill(_argumentFromShortName, _argumentFromShortName + 256, static_cast<Argument*>(NULL));
     addArgument("-h|--help", "help", "show this help message and exit");
 }
 
-Argparsor::~Argparsor() {}
+/**
+ * @brief Unmap the response files
+ *
+ * @param mappedFiles
+ */
+static void unmapFiles(std::vector<std::pair<void*, std::size_t> >* mappedFiles) {
+    for (std::size_t i = 0 ; i < mappedFiles->size() ; ++i) {
+        ::munmap((*mappedFiles)[i].first, (*mappedFiles)[i].second);
+    }
+    mappedFiles->clear();
+}
 
-Argparsor::Argument::Argument() :
-    std::vector<Argument>(),
-    names(std::vector<std::string>()),
+Argparsor::~Argparsor() {
+    unmapFiles(&_mappedFiles);
+    std::list<Subcommand>::iterator it;
+    for (it = _subcommands.begin() ; it != _subcommands.end() ; ++it) {
+        delete it->argparsor;
+    }
+    delete _usageMutex;
+    delete _subcommandMutex;
+}
+
+Argparsor::ParsedArgument::ParsedArgument(const std::vector<Value>* arena) :
     _isExist(false),
-    _isRequired(false),
     _count(0),
+    _nbArgs(0),
     _type(NONE),
+    _arena(arena),
+    _valueIndex(0),
+    _valueCount(0),
+    _clearCount(0),
+    _pendingCount(0),
+    _cacheTag(NULL)
+{}
+
+static std::size_t getNbProcessorOnline() {
+    long nbProcessor = ::sysconf(_SC_NPROCESSORS_ONLN);
+    return (nbProcessor > 0) ? nbProcessor : 1;
+}
+
+std::size_t Argparsor::ParsedArgument::getNbProcessor() {
+    return getNbProcessorOnline();
+}
+
+void Argparsor::ParsedArgument::runThreads(void* (*routine)(void*), void* data, std::size_t dataSize,
+                                           std::size_t nbThread) {
+    std::vector<pthread_t> threads(nbThread);
+    std::vector<char> isCreated(nbThread, false);
+    for (std::size_t i = 1 ; i < nbThread ; ++i) {
+        isCreated[i] = (pthread_create(&threads[i], NULL, routine, static_cast<char*>(data) + i * dataSize) == 0);
+    }
+    routine(data);
+    for (std::size_t i = 1 ; i < nbThread ; ++i) {
+        if (isCreated[i]) {
+            pthread_join(threads[i], NULL);
+        }
+        else {
+            // thread not created
+            routine(static_cast<char*>(data) + i * dataSize);
+        }
+    }
+}
+
+Argparsor::Argument::Argument(const std::vector<Value>* arena, std::size_t index) :
+    ParsedArgument(arena),
+    names(std::vector<std::string>()),
+    _isRequired(false),
     _help(std::string()),
     _argHelp(std::string()),
-    _argument(std::string()),
-    _defaultValue(std::string())
+    _defaultValue(std::string()),
+    _defaultArguments(std::vector<std::string>()),
+    _environmentVariable(std::string()),
+    _index(index)
+{}
+
+Argparsor::Result::Result() :
+    _argparsor(NULL),
+    _binaryName(std::string()),
+    _arguments(std::vector<ParsedArgument>()),
+    _values(std::vector<Value>()),
+    _argvCopies(std::list<std::string>()),
+    _mappedFiles(std::vector<std::pair<void*, std::size_t> >()),
+    _additionalArguments(std::vector<std::string>()),
+    _isHelpRequested(false),
+    _subcommandName(std::string()),
+    _subcommand(NULL)
+{}
+
+Argparsor::Result::~Result() {
+    delete _subcommand;
+    unmapFiles(&_mappedFiles);
+}
+
+Argparsor::Batch::Batch() :
+    _size(0),
+    _results(NULL),
+    _errors(std::vector<ParseArgumentException*>()),
+    _commands(std::vector<std::string>())
+{}
+
+Argparsor::Batch::~Batch() {
+    clear(0);
+}
+
+void Argparsor::Batch::clear(std::size_t size) {
+    for (std::size_t i = 0 ; i < _errors.size() ; ++i) {
+        delete _errors[i];
+    }
+    delete[] _results;
+    _size = size;
+    _results = (size > 0) ? new Result[size] : NULL;
+    _errors.assign(size, NULL);
+    _commands.clear();
+    _commands.resize(size);
+}
+
+Argparsor::Snapshot::Snapshot() :
+    _block(NULL),
+    _size(0)
 {}
 
+Argparsor::Snapshot::~Snapshot() {
+    if (_block != NULL) {
+        ::munmap(_block, _size);
+    }
+}
+
+Argparsor::Snapshot::Argument Argparsor::Snapshot::getOption(const char* str) const {
+    if (_block == NULL) {
+        throw AccessDeniedException(str, "option not found");
+    }
+    const Header* header = reinterpret_cast<const Header*>(_block);
+    const Slot* slots = reinterpret_cast<const Slot*>(_block + header->slots);
+    const Record* records = reinterpret_cast<const Record*>(_block + header->records);
+    const std::size_t size = ::strlen(str);
+    const std::size_t mask = header->nbSlot - 1;
+    for (std::size_t i = hashFlag(str, size) & mask ; slots[i].index != 0 ; i = (i + 1) & mask) {
+        if (slots[i].name.size == size && ::memcmp(_block + slots[i].name.offset, str, size) == 0) {
+            return Argument(_block, &records[slots[i].index - 1]);
+        }
+    }
+    throw AccessDeniedException(str, "option not found");
+}
+
+std::vector<std::string> Argparsor::Snapshot::getAdditionalArguments() const {
+    std::vector<std::string> ret;
+    if (_block == NULL) {
+        return ret;
+    }
+    const Header* header = reinterpret_cast<const Header*>(_block);
+    const String* additionalArguments = reinterpret_cast<const String*>(_block + header->additionalArguments);
+    ret.reserve(header->nbAdditionalArgument);
+    for (std::size_t i = 0 ; i < header->nbAdditionalArgument ; ++i) {
+        ret.push_back(std::string(_block + additionalArguments[i].offset, additionalArguments[i].size));
+    }
+    return ret;
+}
+
 static bool compareOption(const Argparsor::Argument& first, const Argparsor::Argument& second) {
     if (first.getType() == Argparsor::Argument::POSITIONAL_ARGUMENT && second.getType() == Argparsor::Argument::POSITIONAL_ARGUMENT) {
         return first.names[0] <= second.names[0];
@@ -216,22 +592,114 @@ static bool compareFlag(const std::string& first, const std::string& second) {
     }
 }
 
-std::ostream& Argparsor::getUsage(std::ostream& oss) {
+void Argparsor::writeUsage(Output& output, const std::string& binaryName) const {
+    if (!_usage.empty()) {
+        output.write(_usage.c_str(), _usage.size());
+        return;
+    }
+    // the const parse can write the usage in many threads
+    _usageMutex->lock();
+    if (!_isUsageCached) {
+        try {
+            std::ostringstream usage("");
+            renderUsage(usage);
+            _usageCache = usage.str();
+        }
+        catch (...) {
+            _usageMutex->unlock();
+            throw;
+        }
+        _isUsageCached = true;
+    }
+    _usageMutex->unlock();
+    output.write("usage: ", 7);
+    output.write(binaryName.c_str(), binaryName.size());
+    output.write(_usageCache.c_str(), _usageCache.size());
+}
+
+std::ostream& Argparsor::getUsage() const {
+    return getUsage(std::cout);
+}
+
+void Argparsor::writeError(Output& output, const ArgumentException& e) const {
+    output.write(_binaryName.c_str(), _binaryName.size());
+    output.write(": ", 2);
+    output.write(e.what(), ::strlen(e.what()));
+    output.write(" -- '", 5);
+    output.write(e.argument(), ::strlen(e.argument()));
+    output.write("'\n", 2);
+}
+
+/**
+ * @brief Write all iovec in file descriptor
+ * retry on the partial writes and the interruptions
+ *
+ * @param fd
+ * @param iov
+ * @param iovcnt
+ */
+static void writeAll(int fd, struct iovec* iov, int iovcnt) {
+    while (iovcnt > 0) {
+        ssize_t ret = ::writev(fd, iov, iovcnt);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        std::size_t written = static_cast<std::size_t>(ret);
+        while (iovcnt > 0 && written >= iov->iov_len) {
+            written -= iov->iov_len;
+            ++iov;
+            --iovcnt;
+        }
+        if (iovcnt > 0) {
+            iov->iov_base = static_cast<char*>(iov->iov_base) + written;
+            iov->iov_len -= written;
+        }
+    }
+}
+
+void Argparsor::FdOutput::write(const char* data, std::size_t size) {
+    if (_size + size <= sizeof(_buffer)) {
+        ::memcpy(_buffer + _size, data, size);
+        _size += size;
+        return;
+    }
+    // too large for buffer: write the buffer and the data together
+    struct iovec iov[2];
+    iov[0].iov_base = _buffer;
+    iov[0].iov_len = _size;
+    iov[1].iov_base = const_cast<char*>(data);
+    iov[1].iov_len = size;
+    writeAll(_fd, iov, 2);
+    _size = 0;
+}
+
+void Argparsor::FdOutput::flush() {
+    if (_size == 0) {
+        return;
+    }
+    struct iovec iov;
+    iov.iov_base = _buffer;
+    iov.iov_len = _size;
+    writeAll(_fd, &iov, 1);
+    _size = 0;
+}
+
+void Argparsor::renderUsage(std::ostream& oss) const {
+    // sort a copy of arguments for can be call during a parse
+    std::list<Argument> arguments(_arguments);
     {
         std::list<Argument>::iterator it;
-        for (it = _arguments.begin(); it != _arguments.end(); ++it) {
+        for (it = arguments.begin(); it != arguments.end(); ++it) {
             std::sort(it->names.begin(), it->names.end(), &compareFlag);
         }
     }
-    _arguments.sort(&compareOption);
-    if (!_usage.empty()) {
-        oss << _usage;
-        return oss;
-    }
-    // usage line
-    oss << "usage: " << _binaryName;
+    arguments.sort(&compareOption);
+    // usage line after the binary name
     std::list<Argument>::const_iterator it;
-    for (it = _arguments.begin() ; it != _arguments.end() ; ++it) {
+    for (it = arguments.begin() ; it != arguments.end() ; ++it) {
         if (it->getType() == Argument::POSITIONAL_ARGUMENT) {
             continue;
         }
@@ -257,7 +725,7 @@ std::ostream& Argparsor::getUsage(std::ostream& oss) {
             oss << ']';
         }
     }
-    for (it = _arguments.begin() ; it != _arguments.end() ; ++it) {
+    for (it = arguments.begin() ; it != arguments.end() ; ++it) {
         if (it->getType() != Argument::POSITIONAL_ARGUMENT) {
             continue;
         }
@@ -270,16 +738,19 @@ std::ostream& Argparsor::getUsage(std::ostream& oss) {
             oss << ']';
         }
     }
+    if (!_subcommands.empty()) {
+        oss << " COMMAND ...";
+    }
     oss << "\n";
     // description
     if (!_description.empty()) {
         oss << "\n" << _description << "\n";
     }
     // optionnal
-    if (!_arguments.empty()) {
+    if (!arguments.empty()) {
         std::list<std::pair<std::string, std::string> > positionals;
         std::list<std::pair<std::string, std::string> > optionnals;
-        for (it = _arguments.begin() ; it != _arguments.end() ; ++it) {
+        for (it = arguments.begin() ; it != arguments.end() ; ++it) {
             std::list<std::pair<std::string, std::string> >* listOption = NULL;
             if (it->getType() == Argument::POSITIONAL_ARGUMENT) {
                 positionals.push_back(std::pair<std::string, std::string>("", ""));
@@ -334,9 +805,21 @@ std::ostream& Argparsor::getUsage(std::ostream& oss) {
             }
             helpStr += "\n";
         }
+        // the subcommands are not built for the usage
+        std::list<std::pair<std::string, std::string> > commands;
+        std::list<Subcommand>::const_iterator commandIt;
+        for (commandIt = _subcommands.begin() ; commandIt != _subcommands.end() ; ++commandIt) {
+            commands.push_back(std::pair<std::string, std::string>("  " + commandIt->name,
+                                                                   "  " + commandIt->help + "\n"));
+        }
         // calculate width max
         std::size_t max = 0;
         std::list<std::pair<std::string, std::string> >::iterator optIt;
+        for (optIt = commands.begin() ; optIt != commands.end() ; ++optIt) {
+            if (max < optIt->first.size()) {
+                max = optIt->first.size();
+            }
+        }
         for (optIt = positionals.begin() ; optIt != positionals.end() ; ++optIt) {
             if (max < optIt->first.size()) {
                 max = optIt->first.size();
@@ -357,6 +840,16 @@ std::ostream& Argparsor::getUsage(std::ostream& oss) {
                 oss << optIt->second;
             }
         }
+        if (!commands.empty()) {
+            oss << "\ncommands:\n";
+            for (optIt = commands.begin() ; optIt != commands.end() ; ++optIt) {
+                oss.width(max);
+                oss.flags(std::ios::left);
+                oss << optIt->first;
+                oss.width(0);
+                oss << optIt->second;
+            }
+        }
         if (!optionnals.empty()) {
             oss << "\noptional arguments:\n";
             for (optIt = optionnals.begin() ; optIt != optionnals.end() ; ++optIt) {
@@ -372,87 +865,427 @@ std::ostream& Argparsor::getUsage(std::ostream& oss) {
     if (!_epilog.empty()) {
         oss << "\n" << _epilog << "\n";
     }
-    return oss;
 }
 
-void Argparsor::parseArguments(int argc, char* argv[], bool alternative, bool strict) {
-    // sort all arguments
+/**
+ * @brief Copy all arguments in one block for the values can be views
+ *
+ * @param argc
+ * @param argv
+ * @param copy
+ * @param argvCopy pointers of arguments in copy
+ */
+static void copyArguments(int argc, char* argv[], std::string* copy, std::vector<char*>* argvCopy) {
+    std::vector<std::size_t> offsets(argc);
+    for (int i = 0 ; i < argc ; ++i) {
+        offsets[i] = copy->size();
+        copy->append(argv[i], ::strlen(argv[i]) + 1);
+    }
+    argvCopy->resize(argc);
+    for (int i = 0 ; i < argc ; ++i) {
+        (*argvCopy)[i] = &(*copy)[offsets[i]];
+    }
+}
 
+void Argparsor::parseArguments(int argc, char* argv[], bool alternative, bool strict) {
+    std::vector<char*> argvCopy;
+    if (!_zeroCopy) {
+        _argvCopies.push_back(std::string());
+        copyArguments(argc, argv, &_argvCopies.back(), &argvCopy);
+        argv = &argvCopy[0];
+    }
     _binaryName = argv[0];
-    // save index of "--" if exist
-    int endIndex = endOptionIndex(argc, argv);
-    // create parse info
-    int i = 1;
-    // foreach argument
-    for (i = 1 ; i < argc ; ++i) {
-        if (isShortOption(argv[i])) {
-            parseShortArgument(endIndex, argv, &i, alternative);
-        }
-        else if (isLongOption(argv[i])) {
-            parseLongArgument(endIndex, argv, &i, alternative);
-        }
-        else if (isEndOption(argv[i])) {
-            ++i;
-            while (i < argc) {
-                parsePositionnalArgument(argv, &i, strict);
-                ++i;
-            }
-            break;
-        }
-        else {
-            parsePositionnalArgument(argv, &i, strict);
+    _subcommandName.clear();
+    ParseContext context(NULL, &_values, &_additionalArguments, &_argvCopies, &_mappedFiles, _zeroCopy);
+    context.additionalArgumentCallback = _additionalArgumentCallback;
+    context.additionalArgumentData = _additionalArgumentData;
+    context.subcommandName = &_subcommandName;
+    parse(&context, argc, argv, alternative, strict);
+}
+
+void Argparsor::reset() {
+    ParseContext context(NULL, &_values, &_additionalArguments, &_argvCopies, &_mappedFiles, _zeroCopy);
+    resetArguments(&context);
+    _additionalArguments.clear();
+    // values of subcommands are views of copies
+    std::list<Subcommand>::iterator it;
+    for (it = _subcommands.begin() ; it != _subcommands.end() ; ++it) {
+        if (it->argparsor != NULL) {
+            it->argparsor->reset();
         }
     }
-    // check help option
-    if (_helpOption != NULL && _helpOption->isExist()) {
-        getUsage();
-        exit(1);
-    }
-    // check require option
-    std::list<Argument>::iterator it;
+    _subcommandName.clear();
+    _argvCopies.clear();
+    unmapFiles(&_mappedFiles);
+}
+
+void Argparsor::parse(int argc, char* argv[], Result* result, bool alternative, bool strict) const {
+    parseResult(argc, argv, result, alternative, strict, false);
+}
+
+void Argparsor::parseResult(int argc, char* argv[], Result* result, bool alternative, bool strict,
+                            bool batch) const {
+    initResult(result);
+    bool zeroCopy = batch || _zeroCopy;
+    std::vector<char*> argvCopy;
+    if (!zeroCopy) {
+        result->_argvCopies.push_back(std::string());
+        copyArguments(argc, argv, &result->_argvCopies.back(), &argvCopy);
+        argv = &argvCopy[0];
+    }
+    result->_binaryName = argv[0];
+    ParseContext context(result->_arguments.empty() ? NULL : &result->_arguments[0], &result->_values,
+                         &result->_additionalArguments, &result->_argvCopies, &result->_mappedFiles, zeroCopy);
+    // a parse in a thread of service must not exit the process
+    context.exitOnHelp = false;
+    context.isBatch = batch;
+    context.useEnvironment = !batch;
+    context.useConfigFile = !batch;
+    context.subcommandName = &result->_subcommandName;
+    context.result = result;
+    if (!batch) {
+        context.additionalArgumentCallback = _additionalArgumentCallback;
+        context.additionalArgumentData = _additionalArgumentData;
+    }
+    resetArguments(&context);
+    parse(&context, argc, argv, alternative, strict);
+}
+
+void Argparsor::initResult(Result* result) const {
+    result->_argparsor = this;
+    result->_isHelpRequested = false;
+    result->_subcommandName.clear();
+    result->_arguments.assign(_nextArgumentIndex, ParsedArgument(&result->_values));
+    std::list<Argument>::const_iterator it;
     for (it = _arguments.begin() ; it != _arguments.end() ; ++it) {
-        if (it->isRequired() && it->isExist() == false) {
-            if (it->getType() == Argument::POSITIONAL_ARGUMENT) {
-                throw ParseArgumentRequiredException(it->names[0].c_str(), "argument is required");
-            }
-            else {
-                throw ParseArgumentRequiredException(it->names[0].c_str(), "option is required");
-            }
-        }
+        result->_arguments[it->_index]._type = it->_type;
+        result->_arguments[it->_index]._nbArgs = it->_nbArgs;
     }
+    result->_additionalArguments.clear();
+    result->_argvCopies.clear();
+    unmapFiles(&result->_mappedFiles);
 }
 
-void Argparsor::addArgument(const std::vector<std::string>& nameOrFlags, const char* actionOrDefault, const char* help,
-                            bool isRequired, const char* argsHelp, std::size_t nbArgs,
-                            const std::vector<std::string>& defaultArgs) {
-    std::vector<std::string> flags = nameOrFlags;
-    std::sort(flags.begin(), flags.end(), &compareFlag);
+/**
+ * @brief Number of lines taken at once by a thread of parseBatch
+ */
+static const std::size_t BATCH_CHUNK_SIZE = 64;
 
-    // check name or flags
-    if (flags.size() == 1 && flags[0][0] != '-') {
-        if (flags[0].empty()) {
-            throw ArgumentException("", "bad name argument");
-        }
-        else if (_argumentFromName.find(flags[0]) != _argumentFromName.end()) {
-            throw ArgumentException(flags[0].c_str(), "bad name argument already exist");
-        }
-        // create option
-        _arguments.push_back(Argument());
-        Argument& option = _arguments.back();
-        _argumentFromName.insert(std::pair<std::string, Argument*>(flags[0], &option));
+/**
+ * @brief State of a thread of parseBatch
+ */
+struct Argparsor::BatchWorker {
 
-        option.setIsRequired(isRequired);
-        option.names.push_back(nameOrFlags[0]);
-        option.setType(Argument::POSITIONAL_ARGUMENT);
-        if (help != NULL) {
-            option.setHelp(help);
+    /**
+     * @brief Take the next lines of worker
+     *
+     * @param first
+     * @param last
+     * @return true if lines are taken
+     */
+    bool takeLines(std::size_t* first, std::size_t* last) {
+        pthread_mutex_lock(&mutex);
+        bool isTaken = (begin < end);
+        if (isTaken) {
+            *first = begin;
+            *last = std::min(end, begin + BATCH_CHUNK_SIZE);
+            begin = *last;
         }
-        if (actionOrDefault != NULL && actionOrDefault[0] != '\0') {
-            option.setArgument(actionOrDefault);
-            option.setDefaultValue(actionOrDefault);
+        pthread_mutex_unlock(&mutex);
+        return isTaken;
+    }
+
+    /**
+     * @brief Take the upper half of lines of first other worker with lines
+     *
+     * @return true if lines are stolen
+     */
+    bool stealLines() {
+        for (std::size_t i = 1 ; i < nbWorker ; ++i) {
+            BatchWorker& victim = workers[(id + i) % nbWorker];
+            pthread_mutex_lock(&victim.mutex);
+            std::size_t stolenBegin = victim.end - (victim.end - victim.begin + 1) / 2;
+            std::size_t stolenEnd = victim.end;
+            victim.end = stolenBegin;
+            pthread_mutex_unlock(&victim.mutex);
+            if (stolenBegin < stolenEnd) {
+                pthread_mutex_lock(&mutex);
+                begin = stolenBegin;
+                end = stolenEnd;
+                pthread_mutex_unlock(&mutex);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const Argparsor* argparsor;
+    Batch* batch;
+    const std::vector<std::pair<const char*, std::size_t> >* lines;
+    bool alternative;
+    bool strict;
+    BatchWorker* workers;
+    std::size_t nbWorker;
+    std::size_t id;
+    pthread_t thread;
+    bool isCreated;
+    pthread_mutex_t mutex;
+    // lines not parsed of worker
+    std::size_t begin;
+    std::size_t end;
+    // message of unexpected exception
+    std::string error;
+};
+
+void* Argparsor::batchWorker(void* data) {
+    BatchWorker* worker = static_cast<BatchWorker*>(data);
+    try {
+        std::size_t first;
+        std::size_t last;
+        while (worker->takeLines(&first, &last) || (worker->stealLines() && worker->takeLines(&first, &last))) {
+            for (std::size_t i = first ; i < last ; ++i) {
+                const std::pair<const char*, std::size_t>& line = (*worker->lines)[i];
+                worker->argparsor->parseBatchLine(worker->batch, i, line.first, line.second, worker->alternative,
+                                                  worker->strict);
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        worker->error = e.what();
+    }
+    return NULL;
+}
+
+/**
+ * @brief Split a command line in arguments separate by '\0'
+ *
+ * @param line
+ * @param size
+ * @param arguments
+ * @param offsets start of each argument in arguments
+ */
+static void splitCommandLine(const char* line, std::size_t size, std::string* arguments,
+                             std::vector<std::size_t>* offsets) {
+    std::size_t position = 0;
+    const char* argument;
+    std::size_t argumentSize;
+    bool isEscaped;
+    while (nextArgument(line, size, &position, &argument, &argumentSize, &isEscaped)) {
+        offsets->push_back(arguments->size());
+        if (isEscaped) {
+            unescapeArgument(argument, argumentSize, arguments);
+        }
+        else {
+            arguments->append(argument, argumentSize);
+        }
+        arguments->push_back('\0');
+    }
+}
+
+void Argparsor::parseBatch(const char* buffer, std::size_t size, Batch* batch, bool alternative, bool strict,
+                           std::size_t nbThread) const {
+    std::vector<std::pair<const char*, std::size_t> > lines;
+    const char* end = buffer + size;
+    for (const char* line = buffer ; line < end ; ) {
+        const char* newline = static_cast<const char*>(::memchr(line, '\n', end - line));
+        const char* lineEnd = (newline != NULL) ? newline : end;
+        std::size_t lineSize = lineEnd - line;
+        if (lineSize > 0 && line[lineSize - 1] == '\r') {
+            --lineSize;
+        }
+        lines.push_back(std::pair<const char*, std::size_t>(line, lineSize));
+        line = lineEnd + 1;
+    }
+    batch->clear(lines.size());
+    if (nbThread == 0) {
+        nbThread = getNbProcessorOnline();
+    }
+    if (nbThread > lines.size()) {
+        nbThread = lines.size();
+    }
+    if (nbThread <= 1) {
+        for (std::size_t i = 0 ; i < lines.size() ; ++i) {
+            parseBatchLine(batch, i, lines[i].first, lines[i].second, alternative, strict);
+        }
+        return;
+    }
+    std::vector<BatchWorker> workers(nbThread);
+    for (std::size_t i = 0 ; i < nbThread ; ++i) {
+        workers[i].argparsor = this;
+        workers[i].batch = batch;
+        workers[i].lines = &lines;
+        workers[i].alternative = alternative;
+        workers[i].strict = strict;
+        workers[i].workers = &workers[0];
+        workers[i].nbWorker = nbThread;
+        workers[i].id = i;
+        workers[i].isCreated = false;
+        workers[i].begin = lines.size() * i / nbThread;
+        workers[i].end = lines.size() * (i + 1) / nbThread;
+        pthread_mutex_init(&workers[i].mutex, NULL);
+    }
+    // the lines of a thread not created are stolen by the others
+    for (std::size_t i = 1 ; i < nbThread ; ++i) {
+        workers[i].isCreated = (pthread_create(&workers[i].thread, NULL, &batchWorker, &workers[i]) == 0);
+    }
+    batchWorker(&workers[0]);
+    for (std::size_t i = 1 ; i < nbThread ; ++i) {
+        if (workers[i].isCreated) {
+            pthread_join(workers[i].thread, NULL);
+        }
+    }
+    for (std::size_t i = 0 ; i < nbThread ; ++i) {
+        pthread_mutex_destroy(&workers[i].mutex);
+    }
+    for (std::size_t i = 0 ; i < nbThread ; ++i) {
+        if (!workers[i].error.empty()) {
+            throw Exception(workers[i].error.c_str());
+        }
+    }
+}
+
+void Argparsor::parseBatchFile(const char* filename, Batch* batch, bool alternative, bool strict,
+                               std::size_t nbThread) const {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw ParseArgumentException(filename, "cannot open file");
+    }
+    std::string buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    parseBatch(buffer.c_str(), buffer.size(), batch, alternative, strict, nbThread);
+}
+
+void Argparsor::setEnvironmentVariable(const char* nameOrFlag, const char* variable) {
+    Argument* argument = _argumentFromName.find(nameOrFlag, ::strlen(nameOrFlag));
+    if (argument == NULL) {
+        throw ArgumentException(nameOrFlag, "argument not found");
+    }
+    const Argument* other = _argumentFromEnvironment.find(variable, ::strlen(variable));
+    if (other != NULL && other != argument) {
+        throw ArgumentException(variable, "environment variable already used");
+    }
+    _argumentFromEnvironment.erase(argument);
+    argument->_environmentVariable = variable;
+    if (!argument->_environmentVariable.empty()) {
+        _argumentFromEnvironment.insert(argument->_environmentVariable, argument);
+    }
+}
+
+void Argparsor::addSubcommand(const char* name, SubcommandBuilder builder, const char* help, void* data) {
+    if (name == NULL || name[0] == '\0') {
+        throw ArgumentException("", "invalid empty subcommand");
+    }
+    if (name[0] == '-') {
+        throw ArgumentException(name, "invalid subcommand start by '-' character");
+    }
+    if (builder == NULL) {
+        throw ArgumentException(name, "invalid subcommand without builder");
+    }
+    if (findSubcommand(name, ::strlen(name)) != NULL) {
+        throw ArgumentException(name, "invalid subcommand already exist");
+    }
+    Subcommand subcommand;
+    subcommand.name = name;
+    subcommand.help = (help == NULL) ? "" : help;
+    subcommand.builder = builder;
+    subcommand.data = data;
+    subcommand.hash = hashFlag(name, subcommand.name.size());
+    subcommand.argparsor = NULL;
+    _subcommands.push_back(subcommand);
+    // keep a load factor lower than 1/2
+    if (_subcommands.size() * 2 > _subcommandSlots.size()) {
+        std::vector<Subcommand*> slots(std::max(_subcommandSlots.size() * 2, static_cast<std::size_t>(16)),
+                                       static_cast<Subcommand*>(NULL));
+        _subcommandSlots.swap(slots);
+        std::list<Subcommand>::iterator it;
+        for (it = _subcommands.begin() ; it != _subcommands.end() ; ++it) {
+            insertSubcommand(&(*it));
+        }
+    }
+    else {
+        insertSubcommand(&_subcommands.back());
+    }
+    _isUsageCached = false;
+}
+
+const Argparsor& Argparsor::getSubcommand() const {
+    const Subcommand* subcommand = findSubcommand(_subcommandName.c_str(), _subcommandName.size());
+    if (subcommand == NULL || subcommand->argparsor == NULL) {
+        throw AccessDeniedException(_subcommandName.c_str(), "subcommand not found");
+    }
+    return *subcommand->argparsor;
+}
+
+void Argparsor::snapshot(Snapshot* snapshot) const {
+    snapshotState(_binaryName, NULL, _additionalArguments, snapshot);
+}
+
+void Argparsor::snapshot(const Result& result, Snapshot* snapshot) const {
+    if (result._argparsor != this || result._arguments.size() != _nextArgumentIndex) {
+        throw Exception("result is not parsed by this argparsor");
+    }
+    snapshotState(result._binaryName, result._arguments.empty() ? NULL : &result._arguments[0],
+                  result._additionalArguments, snapshot);
+}
+
+void Argparsor::parseBatchLine(Batch* batch, std::size_t index, const char* line, std::size_t size,
+                               bool alternative, bool strict) const {
+    std::string& command = batch->_commands[index];
+    std::vector<std::size_t> offsets;
+    splitCommandLine(line, size, &command, &offsets);
+    // empty binary name of empty line
+    if (offsets.empty()) {
+        offsets.push_back(command.size());
+        command.push_back('\0');
+    }
+    std::vector<char*> argv(offsets.size());
+    for (std::size_t i = 0 ; i < offsets.size() ; ++i) {
+        argv[i] = &command[offsets[i]];
+    }
+    try {
+        // values are views of command kept in batch
+        parseResult(argv.size(), &argv[0], &batch->_results[index], alternative, strict, true);
+    }
+    catch (const ParseArgumentRequiredException& e) {
+        batch->_errors[index] = new ParseArgumentRequiredException(e);
+    }
+    catch (const ParseArgumentException& e) {
+        batch->_errors[index] = new ParseArgumentException(e);
+    }
+}
+
+void Argparsor::addArgument(const std::vector<std::string>& nameOrFlags, const char* actionOrDefault, const char* help,
+                            bool isRequired, const char* argsHelp, std::size_t nbArgs,
+                            const std::vector<std::string>& defaultArgs) {
+    _isUsageCached = false;
+    std::vector<std::string> flags = nameOrFlags;
+    std::sort(flags.begin(), flags.end(), &compareFlag);
+
+    // check name or flags
+    if (flags.size() == 1 && flags[0][0] != '-') {
+        if (flags[0].empty()) {
+            throw ArgumentException("", "bad name argument");
+        }
+        else if (_argumentFromName.find(flags[0]) != NULL) {
+            throw ArgumentException(flags[0].c_str(), "bad name argument already exist");
+        }
+        // create option
+        _arguments.push_back(Argument(&_values, _nextArgumentIndex++));
+        Argument& option = _arguments.back();
+        _argumentFromName.insert(flags[0], &option);
+        _positionalArguments.push_back(&option);
+
+        option.setIsRequired(isRequired);
+        option.names.push_back(nameOrFlags[0]);
+        option.setType(Argument::POSITIONAL_ARGUMENT);
+        if (help != NULL) {
+            option.setHelp(help);
+        }
+        if (actionOrDefault != NULL && actionOrDefault[0] != '\0') {
+            setDefaultArguments(&option, std::vector<std::string>(1, actionOrDefault));
+            option.setDefaultValue(actionOrDefault);
         }
         else if (defaultArgs.size() == 1) {
-            option.setArgument(defaultArgs[0]);
+            setDefaultArguments(&option, defaultArgs);
             option.setDefaultValue(defaultArgs[0]);
         }
         return;
@@ -490,22 +1323,15 @@ void Argparsor::addArgument(const std::vector<std::string>& nameOrFlags, const c
 
     // remove last help option
     if (action == HELP && _helpOption != NULL) {
+        _argumentFromName.erase(_helpOption);
+        _argumentFromEnvironment.erase(_helpOption);
+        std::replace(_argumentFromShortName, _argumentFromShortName + 256, _helpOption, static_cast<Argument*>(NULL));
         for (std::list<Argument>::iterator itList = _arguments.begin() ; itList != _arguments.end() ; ++itList) {
             if (_helpOption == &(*itList)) {
                 _arguments.erase(itList);
                 break;
             }
         }
-        std::map<std::string, Argument*>::iterator itMap = _argumentFromName.begin();
-        while (itMap != _argumentFromName.end()) {
-            if (_helpOption == itMap->second) {
-                _argumentFromName.erase(itMap);
-                itMap = _argumentFromName.begin();
-            }
-            else {
-                ++itMap;
-            }
-        }
         _helpOption = NULL;
     }
     if (nameOrFlags.empty()) {
@@ -520,7 +1346,7 @@ void Argparsor::addArgument(const std::vector<std::string>& nameOrFlags, const c
     const char* shortFlag = NULL;
     const char* longFlag = NULL;
     // create argument
-    _arguments.push_back(Argument());
+    _arguments.push_back(Argument(&_values, _nextArgumentIndex++));
     Argument& argument = _arguments.back();
     for (std::size_t i = 0 ; i < flags.size() ; ++i) {
         if (flags[i][0] != '-') {
@@ -538,7 +1364,7 @@ void Argparsor::addArgument(const std::vector<std::string>& nameOrFlags, const c
             throw ArgumentException(flags[i].c_str(), "invalid short flag has not only one character");
         }
 
-        if (_argumentFromName.find(flags[i]) != _argumentFromName.end()) {
+        if (_argumentFromName.find(flags[i]) != NULL) {
             throw ArgumentException(flags[i].c_str(), "invalid flag already exist");
         }
 
@@ -548,7 +1374,10 @@ void Argparsor::addArgument(const std::vector<std::string>& nameOrFlags, const c
         else if (shortFlag == NULL && flags[i][0] == '-' && flags[i][1] != '-') {
             shortFlag = flags[i].c_str();
         }
-        _argumentFromName.insert(std::pair<std::string, Argument*>(flags[i], &argument));
+        _argumentFromName.insert(flags[i], &argument);
+        if (flags[i].size() == PREFIX_SIZEOF_SHORT_OPTION + 1) {
+            _argumentFromShortName[static_cast<unsigned char>(flags[i][1])] = &argument;
+        }
         argument.names.push_back(flags[i]);
     }
     if (nbArgs > 0 && (argsHelp == NULL || argsHelp[0] == '\0')) {
@@ -633,11 +1462,9 @@ void Argparsor::addArgument(const std::vector<std::string>& nameOrFlags, const c
                     if (i > 0) {
                         argument.setDefaultValue(argument.getDefaultValue() + ", ");
                     }
-                    argument.push_back(Argument());
-                    argument.back().setArgument(defaultArgs[i]);
-                    argument.back().setDefaultValue(defaultArgs[i]);
                     argument.setDefaultValue(argument.getDefaultValue() + defaultArgs[i]);
                 }
+                setDefaultArguments(&argument, defaultArgs);
                 break;
             case Argument::MULTI_OPTION:
             case Argument::INFINITE_OPTION:
@@ -646,11 +1473,9 @@ void Argparsor::addArgument(const std::vector<std::string>& nameOrFlags, const c
                     if (i > 0) {
                         argument.setDefaultValue(argument.getDefaultValue() + ", ");
                     }
-                    argument.push_back(Argument());
-                    argument.back().setArgument(defaultArgs[i]);
-                    argument.back().setDefaultValue(defaultArgs[i]);
                     argument.setDefaultValue(argument.getDefaultValue() + defaultArgs[i]);
                 }
+                setDefaultArguments(&argument, defaultArgs);
                 break;
             case Argument::MULTI_NUMBER_OPTION:
                 if (defaultArgs.size() % nbArgs != 0) {
@@ -666,21 +1491,15 @@ void Argparsor::addArgument(const std::vector<std::string>& nameOrFlags, const c
                         argument.setDefaultValue(argument.getDefaultValue() + ", ");
                     }
                     argument.setDefaultValue(argument.getDefaultValue() + "(");
-                    argument.push_back(Argument());
-                    argument.back().setType(Argument::NUMBER_OPTION);
                     for (std::size_t j = 0 ; j < nbArgs ; ++j) {
                         if (j > 0) {
                             argument.setDefaultValue(argument.getDefaultValue() + ", ");
-                            argument.back().setDefaultValue(argument.back().getDefaultValue() + ", ");
                         }
-                        argument.back().push_back(Argument());
-                        argument.back().back().setArgument(defaultArgs[i * nbArgs + j]);
-                        argument.back().back().setDefaultValue(defaultArgs[i * nbArgs + j]);
                         argument.setDefaultValue(argument.getDefaultValue() + defaultArgs[i * nbArgs + j]);
-                        argument.back().setDefaultValue(argument.back().getDefaultValue() + defaultArgs[i * nbArgs + j]);
                     }
                     argument.setDefaultValue(argument.getDefaultValue() + ")");
                 }
+                setDefaultArguments(&argument, defaultArgs);
                 break;
             default:
                 if (longFlag != NULL) {
@@ -713,6 +1532,87 @@ void Argparsor::addArgument(const char* nameOrFlags, const char* actionOrDefault
     addArgument(flags, actionOrDefault, help, isRequired, argsHelp, nbArgs, defaultArgs);
 }
 
+void Argparsor::commitValues(ParseContext* context) const {
+    std::vector<PendingValue>& pendingValues = context->pendingValues;
+    std::list<Argument>::const_iterator it;
+    // count the values not removed by a clear
+    for (std::size_t i = 0 ; i < pendingValues.size() ; ++i) {
+        if (pendingValues[i].clearCount == pendingValues[i].argument->_clearCount) {
+            ++pendingValues[i].argument->_pendingCount;
+        }
+    }
+    std::size_t size = 0;
+    for (it = _arguments.begin() ; it != _arguments.end() ; ++it) {
+        const ParsedArgument* argument = context->state(&(*it));
+        if (argument->_clearCount == 0) {
+            size += argument->_valueCount;
+        }
+        size += argument->_pendingCount;
+    }
+    // build the new arena with a contiguous range by argument
+    std::vector<Value> values;
+    values.reserve(size);
+    for (it = _arguments.begin() ; it != _arguments.end() ; ++it) {
+        ParsedArgument* argument = context->state(&(*it));
+        std::size_t index = values.size();
+        if (argument->_clearCount == 0) {
+            values.insert(values.end(), context->values->begin() + argument->_valueIndex,
+                          context->values->begin() + argument->_valueIndex + argument->_valueCount);
+        }
+        std::size_t pendingCount = argument->_pendingCount;
+        // now used as write position of pending values
+        argument->_pendingCount = values.size();
+        values.resize(values.size() + pendingCount);
+        argument->_valueIndex = index;
+        argument->_valueCount = values.size() - index;
+        argument->_cacheTag = NULL;
+    }
+    for (std::size_t i = 0 ; i < pendingValues.size() ; ++i) {
+        ParsedArgument* argument = pendingValues[i].argument;
+        if (pendingValues[i].clearCount == argument->_clearCount) {
+            values[argument->_pendingCount++] = pendingValues[i].value;
+        }
+    }
+    for (it = _arguments.begin() ; it != _arguments.end() ; ++it) {
+        ParsedArgument* argument = context->state(&(*it));
+        argument->_clearCount = 0;
+        argument->_pendingCount = 0;
+    }
+    context->values->swap(values);
+    pendingValues.clear();
+}
+
+void Argparsor::resetArguments(ParseContext* context) const {
+    // the default values are views of the default arguments
+    context->values->clear();
+    std::list<Argument>::const_iterator it;
+    for (it = _arguments.begin() ; it != _arguments.end() ; ++it) {
+        ParsedArgument* argument = context->state(&(*it));
+        argument->_isExist = false;
+        argument->_count = 0;
+        argument->_valueIndex = context->values->size();
+        argument->_valueCount = it->_defaultArguments.size();
+        argument->_cacheTag = NULL;
+        for (std::size_t i = 0 ; i < it->_defaultArguments.size() ; ++i) {
+            const std::string& defaultArgument = it->_defaultArguments[i];
+            context->values->push_back(Value(defaultArgument.c_str(), defaultArgument.size()));
+        }
+    }
+    context->pendingValues.clear();
+}
+
+void Argparsor::setDefaultArguments(Argument* argument, const std::vector<std::string>& defaultArgs) {
+    // default arguments are not modified after for keep the views valid
+    argument->_defaultArguments = defaultArgs;
+    argument->_valueIndex = _values.size();
+    argument->_valueCount = defaultArgs.size();
+    argument->_cacheTag = NULL;
+    for (std::size_t i = 0 ; i < argument->_defaultArguments.size() ; ++i) {
+        const std::string& defaultArgument = argument->_defaultArguments[i];
+        _values.push_back(Value(defaultArgument.c_str(), defaultArgument.size()));
+    }
+}
+
 std::string Argparsor::dump() {
     {
         std::list<Argument>::iterator it;
@@ -739,262 +1639,1813 @@ std::string Argparsor::dump() {
     return oss.str();
 }
 
+std::size_t Argparsor::serialize(char* buffer, std::size_t size, Format format) const {
+    return serializeState(_binaryName, NULL, _additionalArguments, buffer, size, format);
+}
+
+std::size_t Argparsor::serialize(const Result& result, char* buffer, std::size_t size, Format format) const {
+    if (result._argparsor != this || result._arguments.size() != _nextArgumentIndex) {
+        throw Exception("result is not parsed by this argparsor");
+    }
+    return serializeState(result._binaryName, result._arguments.empty() ? NULL : &result._arguments[0],
+                          result._additionalArguments, buffer, size, format);
+}
+
+/**
+ * @brief Header of BINARY_FORMAT with its version
+ */
+static const char BINARY_MAGIC[] = {'A', 'R', 'G', 'P', 1};
+
+void Argparsor::deserialize(const char* buffer, std::size_t size, Result* result) const {
+    initResult(result);
+    ParseContext context(result->_arguments.empty() ? NULL : &result->_arguments[0], &result->_values,
+                         &result->_additionalArguments, &result->_argvCopies, &result->_mappedFiles, false);
+    resetArguments(&context);
+    // storage of the values
+    result->_argvCopies.push_back(std::string());
+    try {
+        if (size >= sizeof(BINARY_MAGIC) && ::memcmp(buffer, BINARY_MAGIC, sizeof(BINARY_MAGIC)) == 0) {
+            deserializeBinary(&context, buffer, size, result);
+        }
+        else {
+            deserializeJson(&context, buffer, size, result);
+        }
+    }
+    catch (...) {
+        commitValues(&context);
+        throw;
+    }
+    commitValues(&context);
+}
+
 /*
 ** private
 */
 
-void Argparsor::parseShortArgument(int maxIndex, char* argv[], int* index, bool alternative) {
-    std::string options;
-    std::string arg;
-    std::map<std::string, Argument*>::iterator it;
-    bool hasArg = takeArg(argv[*index], &options, &arg);
-    if (alternative) {
-        // try to find long option
-        it = _argumentFromName.find("-" + options);
-        if (it != _argumentFromName.end()) {
-            parseArgument(maxIndex, argv, index, hasArg, options.c_str() + PREFIX_SIZEOF_SHORT_OPTION,
-                          arg.c_str(), it->second, alternative);
-            return ;
+/**
+ * @brief Argument classified by TokenStream
+ */
+struct Argparsor::Token {
+    enum Kind {
+        POSITIONAL = 0,
+        SHORT_OPTION,
+        ALTERNATIVE_OPTION,
+        LONG_OPTION,
+        END_OPTION
+    };
+    Kind kind;
+    // argument (not null terminated for the arguments of response file)
+    const char* data;
+    std::size_t size;
+    // size of option name before '='
+    std::size_t nameSize;
+    // argument after '=' or NULL
+    const char* arg;
+    std::size_t argSize;
+    // argument of option (last option for multi short option) or NULL if not found
+    Argument* argument;
+    // is a valid option, stop the values of infinite option
+    bool isOption;
+    // data is a view of response file
+    bool isView;
+};
+
+/**
+ * @brief Classify the arguments of argv and of response files one by one during the parse
+ */
+class Argparsor::TokenStream {
+
+  public:
+
+    TokenStream(const Argparsor* argparsor, ParseContext* context, int argc, char* argv[], bool alternative) :
+        _argparsor(argparsor),
+        _context(context),
+        _argc(argc),
+        _argv(argv),
+        _argvIndex(1),
+        _alternative(alternative),
+        _isEnd(false),
+        _sources(),
+        _tokens() {}
+
+    /**
+     * @brief Get the token at offset of current token
+     *
+     * @param offset
+     * @return const Token* or NULL if there is not more token
+     */
+    const Token* peek(std::size_t offset) {
+        while (_tokens.size() <= offset) {
+            Token token;
+            if (!readToken(&token)) {
+                return NULL;
+            }
+            _tokens.push_back(token);
+        }
+        return &_tokens[offset];
+    }
+
+    /**
+     * @brief Get the token at offset of current token if it can be a value of option
+     *
+     * @param offset
+     * @return const Token* or NULL if there is not more token or token is "--"
+     */
+    const Token* peekValue(std::size_t offset) {
+        const Token* token = peek(offset);
+        if (token == NULL || token->kind == Token::END_OPTION) {
+            return NULL;
+        }
+        return token;
+    }
+
+    /**
+     * @brief Read the arguments of buffer as values only (no option and no response file)
+     *
+     * @param data
+     * @param size
+     */
+    void setValues(const char* data, std::size_t size) {
+        Source source;
+        source.data = data;
+        source.size = size;
+        source.position = 0;
+        source.depth = 0;
+        _sources.push_back(source);
+        _isEnd = true;
+    }
+
+    /**
+     * @brief Remove the current token
+     */
+    void pop() {
+        _tokens.pop_front();
+    }
+
+    /**
+     * @brief Remove all next tokens and get them as null terminated arguments
+     *
+     * @param arguments
+     */
+    void takeArguments(std::vector<char*>* arguments) {
+        const Token* token;
+        while ((token = peek(0)) != NULL) {
+            if (token->isView) {
+                _context->copies->push_back(std::string(token->data, token->size));
+                arguments->push_back(const_cast<char*>(_context->copies->back().c_str()));
+            }
+            else {
+                arguments->push_back(const_cast<char*>(token->data));
+            }
+            pop();
+        }
+    }
+
+    /**
+     * @brief Get the number of tokens not parsed without the arguments of response files not read
+     *
+     * @return std::size_t
+     */
+    std::size_t remaining() const {
+        return _tokens.size() + (_argc - _argvIndex);
+    }
+
+  private:
+
+    /**
+     * @brief Content of a response file
+     */
+    struct Source {
+        const char* data;
+        std::size_t size;
+        std::size_t position;
+        std::size_t depth;
+    };
+
+    /**
+     * @brief Read and classify the next argument, response files are replaced by their arguments
+     *
+     * @param token
+     * @return false if there is not more argument
+     */
+    bool readToken(Token* token) {
+        while (true) {
+            const char* data;
+            std::size_t size;
+            std::size_t depth = 0;
+            bool isView = false;
+            if (!_sources.empty()) {
+                Source& source = _sources.back();
+                bool isEscaped;
+                if (!nextArgument(source.data, source.size, &source.position, &data, &size, &isEscaped)) {
+                    _sources.pop_back();
+                    continue;
+                }
+                if (isEscaped) {
+                    _context->copies->push_back(std::string());
+                    unescapeArgument(data, size, &_context->copies->back());
+                    data = _context->copies->back().c_str();
+                    size = _context->copies->back().size();
+                }
+                else {
+                    isView = true;
+                }
+                depth = source.depth;
+            }
+            else if (_argvIndex < static_cast<std::size_t>(_argc)) {
+                data = _argv[_argvIndex++];
+                size = ::strlen(data);
+            }
+            else {
+                return false;
+            }
+            if (!_isEnd && size > 0 && _argparsor->_fromFilePrefixChars.find(data[0]) != std::string::npos) {
+                openFile(std::string(data + 1, size - 1), depth + 1);
+                continue;
+            }
+            classify(data, size, token);
+            token->isView = isView;
+            return true;
+        }
+    }
+
+    /**
+     * @brief Add the arguments of file before the next arguments
+     *
+     * @param filename
+     * @param depth
+     */
+    void openFile(const std::string& filename, std::size_t depth) {
+        if (depth > RESPONSE_FILE_MAX_DEPTH) {
+            throw ParseArgumentException(filename.c_str(), "too many recursive response files");
+        }
+        Source source;
+        source.position = 0;
+        source.depth = depth;
+        _argparsor->loadFile(_context, filename, &source.data, &source.size);
+        _sources.push_back(source);
+    }
+
+    /**
+     * @brief Set the kind of argument and its option
+     *
+     * @param data
+     * @param size
+     * @param token
+     */
+    void classify(const char* data, std::size_t size, Token* token) {
+        *token = Token();
+        token->data = data;
+        token->size = size;
+        // all arguments after "--" are positionals
+        if (_isEnd) {
+            token->kind = Token::POSITIONAL;
+        }
+        else if (isShortOption(data, size)) {
+            token->kind = Token::SHORT_OPTION;
+            token->arg = takeArg(data, size, &token->nameSize, &token->argSize);
+            if (_alternative) {
+                // try to find long option
+                token->argument = _argparsor->_argumentFromName.find("-", PREFIX_SIZEOF_SHORT_OPTION, data,
+                                                                     token->nameSize);
+                if (token->argument != NULL) {
+                    token->kind = Token::ALTERNATIVE_OPTION;
+                    token->isOption = true;
+                }
+            }
+            if (token->kind == Token::SHORT_OPTION) {
+                // firsts options must be boolean
+                token->isOption = true;
+                for (std::size_t j = 1 ; j < token->nameSize - 1 ; ++j) {
+                    const Argument* argument = _argparsor->_argumentFromShortName[static_cast<unsigned char>(data[j])];
+                    if (argument == NULL || (argument->getType() != Argument::BOOLEAN_OPTION &&
+                                             argument->getType() != Argument::REVERSE_BOOLEAN_OPTION)) {
+                        token->isOption = false;
+                        break;
+                    }
+                }
+                token->argument =
+                    _argparsor->_argumentFromShortName[static_cast<unsigned char>(data[token->nameSize - 1])];
+                if (token->argument == NULL) {
+                    token->isOption = false;
+                }
+            }
+        }
+        else if (isLongOption(data, size)) {
+            token->kind = Token::LONG_OPTION;
+            token->arg = takeArg(data, size, &token->nameSize, &token->argSize);
+            token->argument = _argparsor->_argumentFromName.find(data, token->nameSize);
+            token->isOption = (token->argument != NULL);
+        }
+        else if (isEndOption(data, size)) {
+            token->kind = Token::END_OPTION;
+            _isEnd = true;
+        }
+    }
+
+    const Argparsor* _argparsor;
+    ParseContext* _context;
+    int _argc;
+    char** _argv;
+    std::size_t _argvIndex;
+    bool _alternative;
+    // "--" is read
+    bool _isEnd;
+    // response files in reading
+    std::vector<Source> _sources;
+    // tokens read and not parsed
+    std::deque<Token> _tokens;
+};
+
+void Argparsor::parse(ParseContext* context, int argc, char* argv[], bool alternative, bool strict) const {
+    TokenStream stream(this, context, argc, argv, alternative);
+    try {
+        const Token* token;
+        while ((token = stream.peek(0)) != NULL) {
+            switch (token->kind) {
+                case Token::SHORT_OPTION:
+                case Token::ALTERNATIVE_OPTION:
+                    parseShortArgument(context, &stream);
+                    break;
+                case Token::LONG_OPTION:
+                    parseLongArgument(context, &stream);
+                    break;
+                case Token::END_OPTION:
+                    // next arguments are positionals
+                    stream.pop();
+                    break;
+                default:
+                    // the positional arguments of argparsor are before the subcommand
+                    if (!_subcommands.empty() && nextPositionalArgument(context) == NULL) {
+                        parseSubcommand(context, &stream, argv[0], alternative, strict);
+                        break;
+                    }
+                    parsePositionnalArgument(context, token->data, token->size, stream.remaining(), strict);
+                    stream.pop();
+                    break;
+            }
         }
+        if (context->useConfigFile && !_configFile.empty()) {
+            context->isExternal.assign(_nextArgumentIndex, false);
+            std::list<Argument>::const_iterator it;
+            for (it = _arguments.begin() ; it != _arguments.end() ; ++it) {
+                context->isExternal[it->_index] = context->state(&(*it))->isExist();
+            }
+        }
+        if (context->useEnvironment) {
+            parseEnvironment(context);
+        }
+        if (context->useConfigFile) {
+            parseConfigFile(context);
+        }
+    }
+    catch (...) {
+        commitValues(context);
+        throw;
+    }
+    commitValues(context);
+    // check help option
+    if (_helpOption != NULL && context->state(_helpOption)->isExist()) {
+        if (context->result != NULL) {
+            context->result->_isHelpRequested = true;
+        }
+        if (context->exitOnHelp) {
+            std::cout.flush();
+            FdOutput output(STDOUT_FILENO);
+            writeUsage(output, argv[0]);
+            output.flush();
+            exit(1);
+        }
+        return;
+    }
+    // check require option
+    std::list<Argument>::const_iterator it;
+    for (it = _arguments.begin() ; it != _arguments.end() ; ++it) {
+        if (it->isRequired() && context->state(&(*it))->isExist() == false) {
+            if (it->getType() == Argument::POSITIONAL_ARGUMENT) {
+                throw ParseArgumentRequiredException(it->names[0].c_str(), "argument is required");
+            }
+            else {
+                throw ParseArgumentRequiredException(it->names[0].c_str(), "option is required");
+            }
+        }
+    }
+}
+
+void Argparsor::parseShortArgument(ParseContext* context, TokenStream* stream) const {
+    const Token token = *stream->peek(0);
+    stream->pop();
+    if (token.kind == Token::ALTERNATIVE_OPTION) {
+        parseArgument(context, stream, token, token.data + PREFIX_SIZEOF_SHORT_OPTION,
+                      token.nameSize - PREFIX_SIZEOF_SHORT_OPTION, token.argument);
+        return ;
     }
     // get firsts option
-    for (std::size_t i = 1 ; i < options.size() - 1 ; ++i) {
-        std::string charOption(options, i, 1);
-        it = _argumentFromName.find("-" + charOption);
-        if (it == _argumentFromName.end()) {
-            throw ParseArgumentException(charOption.c_str(), "invalid option");
+    for (std::size_t i = 1 ; i < token.nameSize - 1 ; ++i) {
+        Argument* argument = _argumentFromShortName[static_cast<unsigned char>(token.data[i])];
+        if (argument == NULL) {
+            throw ParseArgumentException(std::string(1, token.data[i]).c_str(), "invalid option");
         }
-        else if (it->second->getType() != Argument::BOOLEAN_OPTION &&
-                 it->second->getType() != Argument::REVERSE_BOOLEAN_OPTION) {
-            throw ParseArgumentException(charOption.c_str(), "only last option can be use a parameter");
+        else if (argument->getType() != Argument::BOOLEAN_OPTION &&
+                 argument->getType() != Argument::REVERSE_BOOLEAN_OPTION) {
+            throw ParseArgumentException(std::string(1, token.data[i]).c_str(),
+                                         "only last option can be use a parameter");
         }
-        it->second->setIsExist(true);
-        it->second->addCount();
+        ParsedArgument* parsed = context->state(argument);
+        parsed->setIsExist(true);
+        parsed->addCount();
     }
     // get last option
-    std::string charOption(options, options.size() - 1, 1);
-    it = _argumentFromName.find("-" + charOption);
-    if (it == _argumentFromName.end()) {
-        throw ParseArgumentException(charOption.c_str(), "invalid option");
+    if (token.argument == NULL) {
+        throw ParseArgumentException(std::string(1, token.data[token.nameSize - 1]).c_str(), "invalid option");
     }
-    parseArgument(maxIndex, argv, index, hasArg, charOption.c_str(),
-                  arg.c_str(), it->second, alternative);
+    parseArgument(context, stream, token, token.data + token.nameSize - 1, 1, token.argument);
 }
 
-void Argparsor::parseLongArgument(int maxIndex, char* argv[], int* index, bool alternative) {
-    std::string option;
-    std::string arg;
-    std::map<std::string, Argument*>::iterator it;
-    bool hasArg = takeArg(argv[*index], &option, &arg);
-    it = _argumentFromName.find(option);
-    if (it == _argumentFromName.end()) {
-        throw ParseArgumentException(option.c_str() + PREFIX_SIZEOF_LONG_OPTION, "invalid option");
-    }
-    parseArgument(maxIndex, argv, index, hasArg, option.c_str() + PREFIX_SIZEOF_LONG_OPTION,
-                  arg.c_str(), it->second, alternative);
+void Argparsor::parseLongArgument(ParseContext* context, TokenStream* stream) const {
+    const Token token = *stream->peek(0);
+    stream->pop();
+    if (token.argument == NULL) {
+        throw ParseArgumentException(std::string(token.data + PREFIX_SIZEOF_LONG_OPTION,
+                                                 token.nameSize - PREFIX_SIZEOF_LONG_OPTION).c_str(), "invalid option");
+    }
+    parseArgument(context, stream, token, token.data + PREFIX_SIZEOF_LONG_OPTION,
+                  token.nameSize - PREFIX_SIZEOF_LONG_OPTION, token.argument);
 }
 
-void Argparsor::parseArgument(int maxIndex, char* argv[], int* index, bool hasArg, const char* option, const char* arg,
-                              Argument* argument, bool alternative) {
-    if (hasArg) {
-        switch (argument->getType()) {
+void Argparsor::parseArgument(ParseContext* context, TokenStream* stream, const Token& token, const char* option,
+                              std::size_t optionSize, Argument* argument) const {
+    // values of argument in this parse
+    ParsedArgument* parsed = context->state(argument);
+    const char* arg = token.arg;
+    if (arg != NULL) {
+        switch (parsed->getType()) {
             case Argument::BOOLEAN_OPTION:
             case Argument::REVERSE_BOOLEAN_OPTION:
-                throw ParseArgumentException(option, "option cannot use with argument");
+                throw ParseArgumentException(std::string(option, optionSize).c_str(), "option cannot use with argument");
                 break;
             case Argument::SIMPLE_OPTION:
-                argument->setArgument(arg);
+            case Argument::INFINITE_OPTION:
+                clearValues(parsed);
+                pushValue(context, parsed, arg, token.argSize);
                 break;
             case Argument::NUMBER_OPTION:
-                if (argument->nbArgs() != 1) {
-                    throw ParseArgumentException(option, "option cannot use with only 1 argument");
+                if (parsed->nbArgs() != 1) {
+                    throw ParseArgumentException(std::string(option, optionSize).c_str(),
+                                                 "option cannot use with only 1 argument");
                 }
-                argument->clear();
-                argument->push_back(Argument());
-                argument->back().setArgument(arg);
-                break;
-            case Argument::INFINITE_OPTION:
-                argument->clear();
-                argument->push_back(Argument());
-                argument->back().setArgument(arg);
+                clearValues(parsed);
+                pushValue(context, parsed, arg, token.argSize);
                 break;
             case Argument::MULTI_OPTION:
-                if (argument->isExist() == false) {
-                    argument->clear();
-                }
-                argument->push_back(Argument());
-                argument->back().setArgument(arg);
-                break;
             case Argument::MULTI_INFINITE_OPTION:
-                if (argument->isExist() == false) {
-                    argument->clear();
+                if (parsed->isExist() == false) {
+                    clearValues(parsed);
                 }
-                argument->push_back(Argument());
-                argument->back().setArgument(arg);
+                pushValue(context, parsed, arg, token.argSize);
                 break;
             case Argument::MULTI_NUMBER_OPTION:
-                if (argument->nbArgs() != 1) {
-                    throw ParseArgumentException(option, "option cannot use with only 1 argument");
+                if (parsed->nbArgs() != 1) {
+                    throw ParseArgumentException(std::string(option, optionSize).c_str(),
+                                                 "option cannot use with only 1 argument");
                 }
-                if (argument->isExist() == false) {
-                    argument->clear();
+                if (parsed->isExist() == false) {
+                    clearValues(parsed);
                 }
-                argument->push_back(Argument());
-                argument->back().push_back(Argument());
-                argument->back().back().setArgument(arg);
+                pushValue(context, parsed, arg, token.argSize);
                 break;
             default:
                 break;
         }
     }
     else {
-        switch (argument->getType()) {
+        switch (parsed->getType()) {
             case Argument::BOOLEAN_OPTION:
             case Argument::REVERSE_BOOLEAN_OPTION:
                 break;
-            case Argument::SIMPLE_OPTION:
-                if (*index + 1 >= maxIndex) {
-                    throw ParseArgumentException(option, "bad number of argument");
+            case Argument::SIMPLE_OPTION: {
+                const Token* value = stream->peekValue(0);
+                if (value == NULL) {
+                    throw ParseArgumentException(std::string(option, optionSize).c_str(), "bad number of argument");
                 }
-                ++(*index);
-                argument->setArgument(argv[*index]);
+                clearValues(parsed);
+                pushValue(context, parsed, value->data, value->size);
+                stream->pop();
                 break;
+            }
             case Argument::NUMBER_OPTION:
-                argument->clear();
-                if (*index + argument->nbArgs() >= static_cast<unsigned int>(maxIndex)) {
-                    throw ParseArgumentException(option, "bad number of argument");
+                clearValues(parsed);
+                for (std::size_t j = 0 ; j < parsed->nbArgs() ; ++j) {
+                    if (stream->peekValue(j) == NULL) {
+                        throw ParseArgumentException(std::string(option, optionSize).c_str(), "bad number of argument");
+                    }
                 }
-                for (unsigned int j = *index + 1 ; j <= (*index + argument->nbArgs()) ; ++j) {
-                    argument->push_back(Argument());
-                    argument->back().setArgument(argv[j]);
+                for (std::size_t j = 0 ; j < parsed->nbArgs() ; ++j) {
+                    const Token* value = stream->peek(0);
+                    pushValue(context, parsed, value->data, value->size);
+                    stream->pop();
                 }
-                *index += argument->nbArgs();
                 break;
             case Argument::INFINITE_OPTION: {
-                argument->clear();
-                std::size_t countArg = 0;
-                for (int j = *index + 1 ; j < maxIndex ; ++j) {
-                    if (endOfInfiniteArgument(argv[j], alternative)) {
-                        break;
-                    }
-                    argument->push_back(Argument());
-                    argument->back().setArgument(argv[j]);
-                    ++countArg;
+                clearValues(parsed);
+                const Token* value;
+                while ((value = stream->peekValue(0)) != NULL && !value->isOption) {
+                    pushValue(context, parsed, value->data, value->size);
+                    stream->pop();
                 }
-                *index += countArg;
                 break;
             }
             case Argument::MULTI_OPTION: {
-                if (*index + 1 >= maxIndex) {
-                    throw ParseArgumentException(option, "bad number of argument");
+                const Token* value = stream->peekValue(0);
+                if (value == NULL) {
+                    throw ParseArgumentException(std::string(option, optionSize).c_str(), "bad number of argument");
                 }
-                if (argument->isExist() == false) {
-                    argument->clear();
+                if (parsed->isExist() == false) {
+                    clearValues(parsed);
                 }
-                ++(*index);
-                argument->push_back(Argument());
-                argument->back().setArgument(argv[*index]);
+                pushValue(context, parsed, value->data, value->size);
+                stream->pop();
                 break;
             }
             case Argument::MULTI_INFINITE_OPTION: {
-                if (argument->isExist() == false) {
-                    argument->clear();
+                if (parsed->isExist() == false) {
+                    clearValues(parsed);
                 }
-                std::size_t countArg = 0;
-                for (int j = *index + 1 ; j < maxIndex ; ++j) {
-                    if (endOfInfiniteArgument(argv[j], alternative)) {
-                        break;
-                    }
-                    argument->push_back(Argument());
-                    argument->back().setArgument(argv[j]);
-                    ++countArg;
+                const Token* value;
+                while ((value = stream->peekValue(0)) != NULL && !value->isOption) {
+                    pushValue(context, parsed, value->data, value->size);
+                    stream->pop();
                 }
-                *index += countArg;
                 break;
             }
             case Argument::MULTI_NUMBER_OPTION: {
-                if (*index + argument->nbArgs() >= static_cast<unsigned int>(maxIndex)) {
-                    throw ParseArgumentException(option, "bad number of argument");
+                for (std::size_t j = 0 ; j < parsed->nbArgs() ; ++j) {
+                    if (stream->peekValue(j) == NULL) {
+                        throw ParseArgumentException(std::string(option, optionSize).c_str(), "bad number of argument");
+                    }
                 }
-                if (argument->isExist() == false) {
-                    argument->clear();
+                if (parsed->isExist() == false) {
+                    clearValues(parsed);
                 }
-                argument->push_back(Argument());
-                argument->back().setType(Argument::NUMBER_OPTION);
-                for (unsigned int i = *index + 1 ; i <= *index + argument->nbArgs() ; ++i) {
-                    argument->back().push_back(Argument());
-                    argument->back().back().setArgument(argv[i]);
+                for (std::size_t j = 0 ; j < parsed->nbArgs() ; ++j) {
+                    const Token* value = stream->peek(0);
+                    pushValue(context, parsed, value->data, value->size);
+                    stream->pop();
                 }
-                *index += argument->nbArgs();
                 break;
             }
             default:
                 break;
         }
     }
-    argument->setIsExist(true);
-    argument->addCount();
+    parsed->setIsExist(true);
+    parsed->addCount();
 }
 
-bool Argparsor::endOfInfiniteArgument(const char* argument, bool alternative) {
-    std::string option;
-    std::string arg;
-    std::map<std::string, Argument*>::iterator it;
-    if (isShortOption(argument)) {
-        takeArg(argument, &option, &arg);
-        if (alternative) {
-            it = _argumentFromName.find("-" + option);
-            if (it != _argumentFromName.end()) {
-                return true;
-            }
-        }
-        // get firsts option
-        for (std::size_t i = 1 ; i < option.size() - 1 ; ++i) {
-            std::string charOption(option, i, 1);
-            it = _argumentFromName.find("-" + charOption);
-            if (it == _argumentFromName.end()) {
-                return false;
-            }
-            else if (it->second->getType() != Argument::BOOLEAN_OPTION &&
-                     it->second->getType() != Argument::REVERSE_BOOLEAN_OPTION) {
-                return false;
-            }
-        }
-        // get last option
-        std::string charOption(option, option.size() - 1, 1);
-        it = _argumentFromName.find("-" + charOption);
+Argparsor::Argument* Argparsor::nextPositionalArgument(ParseContext* context) const {
+    std::size_t& cursor = context->positionalCursor;
+    // skip the positional arguments already used
+    while (cursor < _positionalArguments.size() && context->state(_positionalArguments[cursor])->isExist()) {
+        ++cursor;
     }
-    else if (isLongOption(argument)) {
-        takeArg(argument, &option, &arg);
-        it = _argumentFromName.find(option);
+    if (cursor < _positionalArguments.size()) {
+        return _positionalArguments[cursor];
     }
-    else {
-        return false;
+    return NULL;
+}
+
+void Argparsor::parsePositionnalArgument(ParseContext* context, const char* argument, std::size_t size,
+                                         std::size_t nbRemaining, bool strict) const {
+    Argument* nextPositional = nextPositionalArgument(context);
+    if (nextPositional != NULL) {
+        ++context->positionalCursor;
+        ParsedArgument* positional = context->state(nextPositional);
+        clearValues(positional);
+        pushValue(context, positional, argument, size);
+        positional->setIsExist(true);
+    }
+    else if (strict) {
+        throw ParseArgumentException(std::string(argument, size).c_str(), "invalid additional argument");
+    }
+    else if (context->additionalArgumentCallback != NULL) {
+        context->additionalArgumentCallback(argument, size, context->additionalArgumentData);
     }
-    if (it == _argumentFromName.end()) {
-        return false;
+    else {
+        std::vector<std::string>& additionalArguments = *context->additionalArguments;
+        if (additionalArguments.capacity() - additionalArguments.size() < nbRemaining) {
+            additionalArguments.reserve(additionalArguments.size() + nbRemaining);
+        }
+        additionalArguments.push_back(std::string(argument, size));
     }
-    return true;
 }
 
-void Argparsor::parsePositionnalArgument(char* argv[], int* index, bool strict) {
-    std::list<Argument>::iterator it;
-    for (it = _arguments.begin() ; it != _arguments.end() ; ++it) {
-        // assign to first not used positional argument
-        if (it->getType() == Argument::POSITIONAL_ARGUMENT && it->isExist() == false) {
-            it->setArgument(argv[*index]);
-            it->setIsExist(true);
-            break;
-        }
+void Argparsor::parseSubcommand(ParseContext* context, TokenStream* stream, const char* binaryName,
+                                bool alternative, bool strict) const {
+    const Token* token = stream->peek(0);
+    Subcommand* subcommand = findSubcommand(token->data, token->size);
+    if (subcommand == NULL) {
+        throw ParseArgumentException(std::string(token->data, token->size).c_str(), "invalid subcommand");
+    }
+    stream->pop();
+    *context->subcommandName = subcommand->name;
+    // binary name of subcommand is "binaryName subcommand"
+    context->copies->push_back(std::string(binaryName) + ' ' + subcommand->name);
+    std::vector<char*> arguments(1, const_cast<char*>(context->copies->back().c_str()));
+    stream->takeArguments(&arguments);
+    Argparsor* argparsor = buildSubcommand(subcommand);
+    if (context->result == NULL) {
+        argparsor->parseArguments(static_cast<int>(arguments.size()), &arguments[0], alternative, strict);
     }
-    if (it == _arguments.end()) {
-        if (strict) {
-            throw ParseArgumentException(argv[*index], "invalid additional argument");
+    else {
+        if (context->result->_subcommand == NULL) {
+            context->result->_subcommand = new Result();
         }
-        else {
-            _additionalArguments.push_back(argv[*index]);
+        argparsor->parseResult(static_cast<int>(arguments.size()), &arguments[0], context->result->_subcommand,
+                               alternative, strict, context->isBatch);
+    }
+}
+
+Argparsor::Subcommand* Argparsor::findSubcommand(const char* name, std::size_t size) const {
+    if (_subcommandSlots.empty()) {
+        return NULL;
+    }
+    const std::size_t mask = _subcommandSlots.size() - 1;
+    const std::size_t hash = hashFlag(name, size);
+    for (std::size_t i = hash & mask ; _subcommandSlots[i] != NULL ; i = (i + 1) & mask) {
+        Subcommand* subcommand = _subcommandSlots[i];
+        if (subcommand->hash == hash && subcommand->name.size() == size &&
+            ::memcmp(subcommand->name.c_str(), name, size) == 0) {
+            return subcommand;
         }
     }
+    return NULL;
+}
+
+void Argparsor::insertSubcommand(Subcommand* subcommand) {
+    const std::size_t mask = _subcommandSlots.size() - 1;
+    std::size_t i = subcommand->hash & mask;
+    while (_subcommandSlots[i] != NULL) {
+        i = (i + 1) & mask;
+    }
+    _subcommandSlots[i] = subcommand;
+}
+
+Argparsor* Argparsor::buildSubcommand(Subcommand* subcommand) const {
+    // the const parse can build the subcommand in many threads
+    _subcommandMutex->lock();
+    if (subcommand->argparsor == NULL) {
+        Argparsor* argparsor = new Argparsor();
+        try {
+            subcommand->builder(*argparsor, subcommand->data);
+        }
+        catch (...) {
+            delete argparsor;
+            _subcommandMutex->unlock();
+            throw;
+        }
+        // arguments of subcommand are views of the storage of parent
+        argparsor->_zeroCopy = true;
+        subcommand->argparsor = argparsor;
+    }
+    Argparsor* argparsor = subcommand->argparsor;
+    _subcommandMutex->unlock();
+    return argparsor;
+}
+
+void Argparsor::parseEnvironment(ParseContext* context) const {
+    if (_argumentFromEnvironment.empty()) {
+        return;
+    }
+    // only one read of environ for all variables of arguments
+    for (char** env = environ ; env != NULL && *env != NULL ; ++env) {
+        const char* variable = *env;
+        const char* equal = ::strchr(variable, '=');
+        if (equal == NULL) {
+            continue;
+        }
+        std::size_t variableSize = equal - variable;
+        Argument* argument = _argumentFromEnvironment.find(variable, variableSize);
+        // arguments of parse have priority
+        if (argument == NULL || context->state(argument)->isExist()) {
+            continue;
+        }
+        const char* value = equal + 1;
+        std::size_t size = ::strlen(value);
+        if (!context->zeroCopy) {
+            context->copies->push_back(std::string(value, size));
+            value = context->copies->back().c_str();
+        }
+        parseValueArgument(context, variable, variableSize, value, size, argument);
+        if (!context->isExternal.empty()) {
+            context->isExternal[argument->_index] = true;
+        }
+    }
+}
+
+/**
+ * @brief Remove the spaces at begin and at end of buffer
+ *
+ * @param data
+ * @param size
+ */
+static void trimSpaces(const char** data, std::size_t* size) {
+    while (*size > 0 && ::isspace(static_cast<unsigned char>(**data))) {
+        ++*data;
+        --*size;
+    }
+    while (*size > 0 && ::isspace(static_cast<unsigned char>((*data)[*size - 1]))) {
+        --*size;
+    }
+}
+
+void Argparsor::parseConfigFile(ParseContext* context) const {
+    if (_configFile.empty()) {
+        return;
+    }
+    const char* data;
+    std::size_t size;
+    loadFile(context, _configFile, &data, &size);
+    // arguments found by the parse or in environment have priority,
+    // the keys repeated in file are added like the options repeated in argv
+    std::string section("");
+    std::string name("");
+    std::size_t position = 0;
+    while (position < size) {
+        // line is a view of file
+        const char* line = data + position;
+        const char* endOfLine = static_cast<const char*>(::memchr(line, '\n', size - position));
+        std::size_t lineSize = (endOfLine == NULL) ? size - position : endOfLine - line;
+        position += lineSize + 1;
+        trimSpaces(&line, &lineSize);
+        if (lineSize == 0 || line[0] == '#' || line[0] == ';') {
+            continue;
+        }
+        if (line[0] == '[') {
+            if (line[lineSize - 1] != ']') {
+                throw ParseArgumentException(std::string(line, lineSize).c_str(), "invalid section");
+            }
+            const char* sectionName = line + 1;
+            std::size_t sectionSize = lineSize - 2;
+            trimSpaces(&sectionName, &sectionSize);
+            section.assign(sectionName, sectionSize);
+            continue;
+        }
+        const char* key = line;
+        std::size_t keySize = lineSize;
+        const char* value = NULL;
+        std::size_t valueSize = 0;
+        const char* equal = static_cast<const char*>(::memchr(line, '=', lineSize));
+        if (equal != NULL) {
+            keySize = equal - line;
+            value = equal + 1;
+            valueSize = lineSize - keySize - 1;
+            trimSpaces(&key, &keySize);
+            trimSpaces(&value, &valueSize);
+        }
+        name.assign("--");
+        if (!section.empty()) {
+            name.append(section);
+            name.append(1, '-');
+        }
+        name.append(key, keySize);
+        Argument* argument = _argumentFromName.find(name);
+        if (argument == NULL) {
+            throw ParseArgumentException(name.c_str() + PREFIX_SIZEOF_LONG_OPTION, "invalid option");
+        }
+        if (context->isExternal[argument->_index]) {
+            continue;
+        }
+        parseValueArgument(context, name.c_str() + PREFIX_SIZEOF_LONG_OPTION, name.size() - PREFIX_SIZEOF_LONG_OPTION,
+                           value, valueSize, argument);
+    }
+}
+
+void Argparsor::parseValueArgument(ParseContext* context, const char* option, std::size_t optionSize,
+                                   const char* value, std::size_t size, Argument* argument) const {
+    ParsedArgument* parsed = context->state(argument);
+    if (value != NULL) {
+        switch (parsed->getType()) {
+            case Argument::BOOLEAN_OPTION:
+            case Argument::REVERSE_BOOLEAN_OPTION:
+            case Argument::NONE: {
+                bool isFound = false;
+                try {
+                    isFound = strto<bool>(value, size);
+                }
+                catch (const StrToException&) {
+                    throw ParseArgumentException(std::string(option, optionSize).c_str(), "invalid boolean value");
+                }
+                if (isFound) {
+                    parsed->setIsExist(true);
+                    parsed->addCount();
+                }
+                return;
+            }
+            case Argument::POSITIONAL_ARGUMENT:
+                clearValues(parsed);
+                pushValue(context, parsed, value, size);
+                parsed->setIsExist(true);
+                return;
+            default:
+                break;
+        }
+    }
+    // no argument of argv in this stream
+    TokenStream stream(this, context, 1, NULL, false);
+    Token token = Token();
+    token.kind = Token::LONG_OPTION;
+    token.data = option;
+    token.size = optionSize;
+    token.nameSize = optionSize;
+    if (value != NULL && parsed->getType() == Argument::SIMPLE_OPTION) {
+        // all the value is the argument
+        token.arg = value;
+        token.argSize = size;
+    }
+    else if (value != NULL) {
+        // the values are separated like the arguments of response file
+        stream.setValues(value, size);
+    }
+    do {
+        parseArgument(context, &stream, token, option, optionSize, argument);
+    } while ((parsed->getType() == Argument::MULTI_OPTION || parsed->getType() == Argument::MULTI_NUMBER_OPTION) &&
+             stream.peek(0) != NULL);
+    if (stream.peek(0) != NULL) {
+        throw ParseArgumentException(std::string(option, optionSize).c_str(), "bad number of argument");
+    }
+}
+
+/**
+ * @brief Read all the content of fd until the end of file,
+ * retry on the interruptions
+ *
+ * @param fd
+ * @param content
+ * @return false on error of read
+ */
+static bool readAll(int fd, std::string* content) {
+    char buffer[4096];
+    while (true) {
+        ssize_t ret = ::read(fd, buffer, sizeof(buffer));
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if (ret == 0) {
+            return true;
+        }
+        content->append(buffer, static_cast<std::size_t>(ret));
+    }
+}
+
+void Argparsor::loadFile(ParseContext* context, const std::string& filename, const char** data,
+                         std::size_t* size) const {
+    *data = "";
+    *size = 0;
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw ParseArgumentException(filename.c_str(), "cannot open file");
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw ParseArgumentException(filename.c_str(), "cannot open file");
+    }
+    if (!S_ISREG(st.st_mode)) {
+        // pipe, fifo or device has not size and cannot be mapped
+        context->copies->push_back(std::string());
+        if (!readAll(fd, &context->copies->back())) {
+            ::close(fd);
+            throw ParseArgumentException(filename.c_str(), "cannot open file");
+        }
+        ::close(fd);
+        *data = context->copies->back().c_str();
+        *size = context->copies->back().size();
+        return;
+    }
+    if (st.st_size > 0) {
+        void* map = ::mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED) {
+            ::close(fd);
+            throw ParseArgumentException(filename.c_str(), "cannot open file");
+        }
+        if (context->zeroCopy) {
+            // values are views of mapped file
+            context->mappedFiles->push_back(std::pair<void*, std::size_t>(map, st.st_size));
+            *data = static_cast<const char*>(map);
+        }
+        else {
+            context->copies->push_back(std::string(static_cast<const char*>(map), st.st_size));
+            ::munmap(map, st.st_size);
+            *data = context->copies->back().c_str();
+        }
+        *size = st.st_size;
+    }
+    ::close(fd);
+}
+
+/**
+ * @brief Name of types of arguments in JSON_FORMAT
+ */
+static const char* const TYPE_NAMES[] = {
+    "NONE",
+    "BOOLEAN_OPTION",
+    "REVERSE_BOOLEAN_OPTION",
+    "SIMPLE_OPTION",
+    "NUMBER_OPTION",
+    "INFINITE_OPTION",
+    "MULTI_OPTION",
+    "MULTI_INFINITE_OPTION",
+    "MULTI_NUMBER_OPTION",
+    "POSITIONAL_ARGUMENT"
+};
+
+static const std::size_t NB_TYPE = sizeof(TYPE_NAMES) / sizeof(*TYPE_NAMES);
+
+/**
+ * @brief Write a string literal without its '\0'
+ *
+ * @tparam N
+ * @param output
+ * @param literal
+ */
+template<std::size_t N>
+static inline void writeLiteral(Argparsor::Output& output, const char (&literal)[N]) {
+    output.write(literal, N - 1);
+}
+
+/**
+ * @brief Write value in 4 bytes little endian
+ *
+ * @param output
+ * @param value
+ */
+static void writeUint32(Argparsor::Output& output, std::size_t value) {
+    if (static_cast<unsigned long>(value) > 0xFFFFFFFFul) {
+        throw Argparsor::Exception("value too large for serialize");
+    }
+    char bytes[4];
+    for (std::size_t i = 0 ; i < 4 ; ++i) {
+        bytes[i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+    }
+    output.write(bytes, 4);
+}
+
+/**
+ * @brief Write the size of data and data
+ *
+ * @param output
+ * @param data
+ * @param size
+ */
+static inline void writeBinaryString(Argparsor::Output& output, const char* data, std::size_t size) {
+    writeUint32(output, size);
+    output.write(data, size);
+}
+
+/**
+ * @brief Write a number in decimal
+ *
+ * @param output
+ * @param value
+ */
+static void writeJsonNumber(Argparsor::Output& output, std::size_t value) {
+    char buffer[24];
+    std::size_t i = sizeof(buffer);
+    do {
+        buffer[--i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    output.write(buffer + i, sizeof(buffer) - i);
+}
+
+/**
+ * @brief Write data between quotes with the escape of quote, backslash and control characters
+ *
+ * @param output
+ * @param data
+ * @param size
+ */
+static void writeJsonString(Argparsor::Output& output, const char* data, std::size_t size) {
+    static const char hexDigits[] = "0123456789abcdef";
+    writeLiteral(output, "\"");
+    std::size_t start = 0;
+    for (std::size_t i = 0 ; i < size ; ++i) {
+        unsigned char c = static_cast<unsigned char>(data[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        output.write(data + start, i - start);
+        start = i + 1;
+        if (c == '"') {
+            writeLiteral(output, "\\\"");
+        }
+        else if (c == '\\') {
+            writeLiteral(output, "\\\\");
+        }
+        else if (c == '\n') {
+            writeLiteral(output, "\\n");
+        }
+        else if (c == '\r') {
+            writeLiteral(output, "\\r");
+        }
+        else if (c == '\t') {
+            writeLiteral(output, "\\t");
+        }
+        else {
+            char escape[6] = {'\\', 'u', '0', '0', hexDigits[c >> 4], hexDigits[c & 0xF]};
+            output.write(escape, sizeof(escape));
+        }
+    }
+    output.write(data + start, size - start);
+    writeLiteral(output, "\"");
+}
+
+/**
+ * @brief Output in a buffer of fixed size, count the size of data after the end of buffer
+ */
+class Argparsor::BufferOutput : public Output {
+
+  public:
+
+    BufferOutput(char* buffer, std::size_t size) : _buffer(buffer), _size(size), _position(0) {}
+
+    virtual ~BufferOutput() {}
+
+    virtual void write(const char* data, std::size_t size) {
+        if (_position < _size) {
+            ::memcpy(_buffer + _position, data, std::min(size, _size - _position));
+        }
+        _position += size;
+    }
+
+    /**
+     * @brief Get the size of data written (or not written after the end of buffer)
+     *
+     * @return std::size_t
+     */
+    inline std::size_t position() const {
+        return _position;
+    }
+
+  private:
+
+    char* _buffer;
+    std::size_t _size;
+    std::size_t _position;
+};
+
+std::size_t Argparsor::serializeState(const std::string& binaryName, const ParsedArgument* states,
+                                      const std::vector<std::string>& additionalArguments, char* buffer,
+                                      std::size_t size, Format format) const {
+    BufferOutput output(buffer, size);
+    std::list<Argument>::const_iterator it;
+    if (format == BINARY_FORMAT) {
+        output.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+        writeBinaryString(output, binaryName.c_str(), binaryName.size());
+        writeUint32(output, _arguments.size());
+        for (it = _arguments.begin() ; it != _arguments.end() ; ++it) {
+            const ParsedArgument& argument = (states == NULL) ? *it : states[it->_index];
+            const Value* values = argument.begin();
+            writeBinaryString(output, it->names[0].c_str(), it->names[0].size());
+            char typeAndExist[2] = {static_cast<char>(argument._type), static_cast<char>(argument._isExist)};
+            output.write(typeAndExist, sizeof(typeAndExist));
+            writeUint32(output, argument._count);
+            // values of groups follow each other
+            writeUint32(output, argument._valueCount);
+            for (std::size_t i = 0 ; i < argument._valueCount ; ++i) {
+                writeBinaryString(output, values[i].data(), values[i].length());
+            }
+        }
+        writeUint32(output, additionalArguments.size());
+        for (std::size_t i = 0 ; i < additionalArguments.size() ; ++i) {
+            writeBinaryString(output, additionalArguments[i].c_str(), additionalArguments[i].size());
+        }
+    }
+    else {
+        writeLiteral(output, "{\"binaryName\":");
+        writeJsonString(output, binaryName.c_str(), binaryName.size());
+        writeLiteral(output, ",\"arguments\":{");
+        for (it = _arguments.begin() ; it != _arguments.end() ; ++it) {
+            const ParsedArgument& argument = (states == NULL) ? *it : states[it->_index];
+            const Value* values = argument.begin();
+            bool isGroup = (argument._type == Argument::MULTI_NUMBER_OPTION);
+            if (it != _arguments.begin()) {
+                writeLiteral(output, ",");
+            }
+            writeJsonString(output, it->names[0].c_str(), it->names[0].size());
+            writeLiteral(output, ":{\"type\":\"");
+            output.write(TYPE_NAMES[argument._type], ::strlen(TYPE_NAMES[argument._type]));
+            writeLiteral(output, "\",\"isExist\":");
+            if (argument._isExist) {
+                writeLiteral(output, "true");
+            }
+            else {
+                writeLiteral(output, "false");
+            }
+            writeLiteral(output, ",\"count\":");
+            writeJsonNumber(output, argument._count);
+            writeLiteral(output, ",\"values\":[");
+            for (std::size_t i = 0 ; i < argument._valueCount ; ++i) {
+                if (i > 0) {
+                    writeLiteral(output, ",");
+                }
+                if (isGroup && i % argument._nbArgs == 0) {
+                    writeLiteral(output, "[");
+                }
+                writeJsonString(output, values[i].data(), values[i].length());
+                if (isGroup && (i + 1) % argument._nbArgs == 0) {
+                    writeLiteral(output, "]");
+                }
+            }
+            writeLiteral(output, "]}");
+        }
+        writeLiteral(output, "},\"additionalArguments\":[");
+        for (std::size_t i = 0 ; i < additionalArguments.size() ; ++i) {
+            if (i > 0) {
+                writeLiteral(output, ",");
+            }
+            writeJsonString(output, additionalArguments[i].c_str(), additionalArguments[i].size());
+        }
+        writeLiteral(output, "]}");
+    }
+    return output.position();
+}
+
+Argparsor::ParsedArgument* Argparsor::deserializeArgument(ParseContext* context, const char* name,
+                                                          std::size_t nameSize,
+                                                          enum ParsedArgument::Type type) const {
+    const Argument* argument = _argumentFromName.find(name, nameSize);
+    if (argument == NULL) {
+        throw ParseArgumentException(std::string(name, nameSize).c_str(), "invalid option");
+    }
+    if (argument->_type != type) {
+        throw ParseArgumentException(std::string(name, nameSize).c_str(), "invalid type of argument");
+    }
+    ParsedArgument* parsedArgument = context->state(argument);
+    clearValues(parsedArgument);
+    return parsedArgument;
+}
+
+/**
+ * @brief Reader of BINARY_FORMAT
+ */
+class Argparsor::BinaryReader {
+
+  public:
+
+    BinaryReader(const char* data, std::size_t size) : _data(data), _size(size), _position(0) {}
+
+    /**
+     * @brief Take size bytes
+     *
+     * @param size
+     * @return const char*
+     */
+    inline const char* read(std::size_t size) {
+        if (size > _size - _position) {
+            throw Exception("invalid serialized result");
+        }
+        const char* data = _data + _position;
+        _position += size;
+        return data;
+    }
+
+    /**
+     * @brief Take a value of 4 bytes little endian
+     *
+     * @return std::size_t
+     */
+    inline std::size_t readUint32() {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(read(4));
+        std::size_t value = 0;
+        for (std::size_t i = 0 ; i < 4 ; ++i) {
+            value |= static_cast<std::size_t>(bytes[i]) << (i * 8);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Take the size of data and data
+     *
+     * @param data
+     * @param size
+     */
+    inline void readString(const char** data, std::size_t* size) {
+        *size = readUint32();
+        *data = read(*size);
+    }
+
+    inline bool isEnd() const {
+        return _position == _size;
+    }
+
+  private:
+
+    const char* _data;
+    std::size_t _size;
+    std::size_t _position;
+};
+
+void Argparsor::deserializeBinary(ParseContext* context, const char* buffer, std::size_t size,
+                                  Result* result) const {
+    // values are views of one copy of buffer
+    std::string& copy = result->_argvCopies.back();
+    copy.assign(buffer, size);
+    BinaryReader reader(copy.c_str(), copy.size());
+    const char* data;
+    std::size_t dataSize;
+    reader.read(sizeof(BINARY_MAGIC));
+    reader.readString(&data, &dataSize);
+    result->_binaryName.assign(data, dataSize);
+    std::size_t nbArgument = reader.readUint32();
+    for (std::size_t i = 0 ; i < nbArgument ; ++i) {
+        const char* name;
+        std::size_t nameSize;
+        reader.readString(&name, &nameSize);
+        const unsigned char* typeAndExist = reinterpret_cast<const unsigned char*>(reader.read(2));
+        if (typeAndExist[0] >= NB_TYPE) {
+            throw Exception("invalid serialized result");
+        }
+        ParsedArgument* argument = deserializeArgument(context, name, nameSize,
+                                                       static_cast<enum ParsedArgument::Type>(typeAndExist[0]));
+        argument->_isExist = (typeAndExist[1] != 0);
+        argument->_count = reader.readUint32();
+        std::size_t nbValue = reader.readUint32();
+        if (argument->_type == Argument::MULTI_NUMBER_OPTION && nbValue % argument->_nbArgs != 0) {
+            throw ParseArgumentException(std::string(name, nameSize).c_str(), "bad number of argument");
+        }
+        for (std::size_t j = 0 ; j < nbValue ; ++j) {
+            reader.readString(&data, &dataSize);
+            pushValue(context, argument, data, dataSize);
+        }
+    }
+    std::size_t nbAdditionalArgument = reader.readUint32();
+    for (std::size_t i = 0 ; i < nbAdditionalArgument ; ++i) {
+        reader.readString(&data, &dataSize);
+        result->_additionalArguments.push_back(std::string(data, dataSize));
+    }
+    if (!reader.isEnd()) {
+        throw Exception("invalid serialized result");
+    }
+}
+
+/**
+ * @brief Reader of JSON_FORMAT, the strings are unescaped in place
+ */
+class Argparsor::JsonReader {
+
+  public:
+
+    /**
+     * @brief Construct a new JsonReader object
+     *
+     * @param data modified by the unescape of strings
+     * @param size
+     */
+    JsonReader(char* data, std::size_t size) :
+        _data(data),
+        _size(size),
+        _position(0),
+        _write(0) {}
+
+    /**
+     * @brief Skip the spaces and take c if it is the next character
+     *
+     * @param c
+     * @return true if c is taken
+     */
+    inline bool take(char c) {
+        skipSpace();
+        if (_position < _size && _data[_position] == c) {
+            ++_position;
+            return true;
+        }
+        return false;
+    }
+
+    inline void expect(char c) {
+        if (!take(c)) {
+            throw Exception("invalid serialized result");
+        }
+    }
+
+    inline bool isEnd() {
+        skipSpace();
+        return _position == _size;
+    }
+
+    /**
+     * @brief Take a string, the unescaped string is a view of data
+     *
+     * @param data
+     * @param size
+     */
+    void readString(const char** data, std::size_t* size) {
+        expect('"');
+        std::size_t start = _position;
+        // an unescaped character is never longer than its escape
+        _write = _position;
+        while (true) {
+            std::size_t begin = _position;
+            while (_position < _size && _data[_position] != '"' && _data[_position] != '\\' &&
+                   static_cast<unsigned char>(_data[_position]) >= 0x20) {
+                ++_position;
+            }
+            if (_write != begin) {
+                ::memmove(_data + _write, _data + begin, _position - begin);
+            }
+            _write += _position - begin;
+            if (_position >= _size || static_cast<unsigned char>(_data[_position]) < 0x20) {
+                throw Exception("invalid serialized result");
+            }
+            if (_data[_position++] == '"') {
+                break;
+            }
+            readEscape();
+        }
+        *data = _data + start;
+        *size = _write - start;
+    }
+
+    /**
+     * @brief Take true or false
+     *
+     * @return bool
+     */
+    bool readBoolean() {
+        skipSpace();
+        if (isLiteral("true")) {
+            return true;
+        }
+        if (isLiteral("false")) {
+            return false;
+        }
+        throw Exception("invalid serialized result");
+    }
+
+    /**
+     * @brief Take an unsigned integer
+     *
+     * @return std::size_t
+     */
+    std::size_t readNumber() {
+        skipSpace();
+        std::size_t begin = _position;
+        std::size_t value = 0;
+        while (_position < _size && _data[_position] >= '0' && _data[_position] <= '9') {
+            value = value * 10 + static_cast<std::size_t>(_data[_position++] - '0');
+        }
+        if (_position == begin) {
+            throw Exception("invalid serialized result");
+        }
+        return value;
+    }
+
+    /**
+     * @brief Take an array of strings or of arrays of strings
+     *
+     * @param values views of strings
+     * @param groupSizes size of each array of strings
+     */
+    void readValues(std::vector<Value>* values, std::vector<std::size_t>* groupSizes) {
+        const char* data;
+        std::size_t size;
+        values->clear();
+        groupSizes->clear();
+        expect('[');
+        if (take(']')) {
+            return;
+        }
+        do {
+            if (take('[')) {
+                std::size_t groupSize = 0;
+                if (!take(']')) {
+                    do {
+                        readString(&data, &size);
+                        values->push_back(Value(data, size));
+                        ++groupSize;
+                    } while (take(','));
+                    expect(']');
+                }
+                groupSizes->push_back(groupSize);
+            }
+            else {
+                readString(&data, &size);
+                values->push_back(Value(data, size));
+            }
+        } while (take(','));
+        expect(']');
+    }
+
+    /**
+     * @brief Skip a value of unknown key
+     */
+    void skipValue() {
+        skipSpace();
+        if (_position >= _size) {
+            throw Exception("invalid serialized result");
+        }
+        const char* data;
+        std::size_t size;
+        char c = _data[_position];
+        if (c == '"') {
+            readString(&data, &size);
+        }
+        else if (c == '{' || c == '[') {
+            char end = (c == '{') ? '}' : ']';
+            ++_position;
+            if (take(end)) {
+                return;
+            }
+            do {
+                if (c == '{') {
+                    readString(&data, &size);
+                    expect(':');
+                }
+                skipValue();
+            } while (take(','));
+            expect(end);
+        }
+        else if (isLiteral("true") || isLiteral("false") || isLiteral("null")) {
+            return;
+        }
+        else {
+            std::size_t begin = _position;
+            while (_position < _size && (::strchr("+-.eE", _data[_position]) != NULL ||
+                                         (_data[_position] >= '0' && _data[_position] <= '9'))) {
+                ++_position;
+            }
+            if (_position == begin) {
+                throw Exception("invalid serialized result");
+            }
+        }
+    }
+
+  private:
+
+    inline void skipSpace() {
+        while (_position < _size && (_data[_position] == ' ' || _data[_position] == '\t' ||
+                                     _data[_position] == '\n' || _data[_position] == '\r')) {
+            ++_position;
+        }
+    }
+
+    /**
+     * @brief Take literal if it is the next characters
+     *
+     * @tparam N
+     * @param literal
+     * @return true if literal is taken
+     */
+    template<std::size_t N>
+    inline bool isLiteral(const char (&literal)[N]) {
+        if (_size - _position >= N - 1 && ::memcmp(_data + _position, literal, N - 1) == 0) {
+            _position += N - 1;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Take 4 hexadecimal digits of \u escape
+     *
+     * @return unsigned long
+     */
+    unsigned long readHex() {
+        if (_size - _position < 4) {
+            throw Exception("invalid serialized result");
+        }
+        unsigned long value = 0;
+        for (std::size_t i = 0 ; i < 4 ; ++i) {
+            char c = _data[_position++];
+            value <<= 4;
+            if (c >= '0' && c <= '9') {
+                value |= static_cast<unsigned long>(c - '0');
+            }
+            else if (c >= 'a' && c <= 'f') {
+                value |= static_cast<unsigned long>(c - 'a' + 10);
+            }
+            else if (c >= 'A' && c <= 'F') {
+                value |= static_cast<unsigned long>(c - 'A' + 10);
+            }
+            else {
+                throw Exception("invalid serialized result");
+            }
+        }
+        return value;
+    }
+
+    /**
+     * @brief Write the character of escape after the backslash
+     */
+    void readEscape() {
+        if (_position >= _size) {
+            throw Exception("invalid serialized result");
+        }
+        char c = _data[_position++];
+        switch (c) {
+            case '"':
+            case '\\':
+            case '/':
+                _data[_write++] = c;
+                break;
+            case 'b':
+                _data[_write++] = '\b';
+                break;
+            case 'f':
+                _data[_write++] = '\f';
+                break;
+            case 'n':
+                _data[_write++] = '\n';
+                break;
+            case 'r':
+                _data[_write++] = '\r';
+                break;
+            case 't':
+                _data[_write++] = '\t';
+                break;
+            case 'u': {
+                unsigned long code = readHex();
+                // surrogate pair
+                if (code >= 0xD800 && code <= 0xDBFF && isLiteral("\\u")) {
+                    unsigned long low = readHex();
+                    if (low < 0xDC00 || low > 0xDFFF) {
+                        throw Exception("invalid serialized result");
+                    }
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                }
+                appendUtf8(code);
+                break;
+            }
+            default:
+                throw Exception("invalid serialized result");
+        }
+    }
+
+    void appendUtf8(unsigned long code) {
+        if (code < 0x80) {
+            _data[_write++] = static_cast<char>(code);
+        }
+        else if (code < 0x800) {
+            _data[_write++] = static_cast<char>(0xC0 | (code >> 6));
+            _data[_write++] = static_cast<char>(0x80 | (code & 0x3F));
+        }
+        else if (code < 0x10000) {
+            _data[_write++] = static_cast<char>(0xE0 | (code >> 12));
+            _data[_write++] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            _data[_write++] = static_cast<char>(0x80 | (code & 0x3F));
+        }
+        else {
+            _data[_write++] = static_cast<char>(0xF0 | (code >> 18));
+            _data[_write++] = static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            _data[_write++] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            _data[_write++] = static_cast<char>(0x80 | (code & 0x3F));
+        }
+    }
+
+    char* _data;
+    std::size_t _size;
+    std::size_t _position;
+    // end of the unescaped string
+    std::size_t _write;
+};
+
+/**
+ * @brief Compare a string of JSON with a key
+ *
+ * @tparam N
+ * @param data
+ * @param size
+ * @param key
+ * @return true if data is key
+ */
+template<std::size_t N>
+static inline bool isJsonKey(const char* data, std::size_t size, const char (&key)[N]) {
+    return size == N - 1 && ::memcmp(data, key, N - 1) == 0;
+}
+
+void Argparsor::deserializeJson(ParseContext* context, const char* buffer, std::size_t size,
+                                Result* result) const {
+    // values are views of one copy of buffer
+    std::string& copy = result->_argvCopies.back();
+    copy.assign(buffer, size);
+    JsonReader reader(&copy[0], copy.size());
+    const char* data;
+    std::size_t dataSize;
+    // values and sizes of groups of an argument
+    std::vector<Value> values;
+    std::vector<std::size_t> groupSizes;
+    reader.expect('{');
+    if (!reader.take('}')) {
+        do {
+            reader.readString(&data, &dataSize);
+            reader.expect(':');
+            if (isJsonKey(data, dataSize, "binaryName")) {
+                reader.readString(&data, &dataSize);
+                result->_binaryName.assign(data, dataSize);
+            }
+            else if (isJsonKey(data, dataSize, "additionalArguments")) {
+                reader.expect('[');
+                if (!reader.take(']')) {
+                    do {
+                        reader.readString(&data, &dataSize);
+                        result->_additionalArguments.push_back(std::string(data, dataSize));
+                    } while (reader.take(','));
+                    reader.expect(']');
+                }
+            }
+            else if (isJsonKey(data, dataSize, "arguments")) {
+                reader.expect('{');
+                if (reader.take('}')) {
+                    continue;
+                }
+                do {
+                    const char* name;
+                    std::size_t nameSize;
+                    reader.readString(&name, &nameSize);
+                    reader.expect(':');
+                    std::size_t type = NB_TYPE;
+                    bool isExist = false;
+                    std::size_t count = 0;
+                    values.clear();
+                    groupSizes.clear();
+                    reader.expect('{');
+                    if (!reader.take('}')) {
+                        do {
+                            reader.readString(&data, &dataSize);
+                            reader.expect(':');
+                            if (isJsonKey(data, dataSize, "type")) {
+                                reader.readString(&data, &dataSize);
+                                for (type = 0 ; type < NB_TYPE ; ++type) {
+                                    if (::strlen(TYPE_NAMES[type]) == dataSize &&
+                                        ::memcmp(TYPE_NAMES[type], data, dataSize) == 0) {
+                                        break;
+                                    }
+                                }
+                            }
+                            else if (isJsonKey(data, dataSize, "isExist")) {
+                                isExist = reader.readBoolean();
+                            }
+                            else if (isJsonKey(data, dataSize, "count")) {
+                                count = reader.readNumber();
+                            }
+                            else if (isJsonKey(data, dataSize, "values")) {
+                                reader.readValues(&values, &groupSizes);
+                            }
+                            else {
+                                reader.skipValue();
+                            }
+                        } while (reader.take(','));
+                        reader.expect('}');
+                    }
+                    if (type >= NB_TYPE) {
+                        throw ParseArgumentException(std::string(name, nameSize).c_str(), "invalid type of argument");
+                    }
+                    ParsedArgument* argument = deserializeArgument(context, name, nameSize,
+                                                                   static_cast<enum ParsedArgument::Type>(type));
+                    argument->_isExist = isExist;
+                    argument->_count = count;
+                    // only the values of MULTI_NUMBER_OPTION are in groups of nbArgs values
+                    bool isValid = groupSizes.empty();
+                    if (argument->_type == Argument::MULTI_NUMBER_OPTION) {
+                        isValid = (groupSizes.size() * argument->_nbArgs == values.size());
+                        for (std::size_t i = 0 ; i < groupSizes.size() ; ++i) {
+                            isValid = isValid && groupSizes[i] == argument->_nbArgs;
+                        }
+                    }
+                    if (!isValid) {
+                        throw ParseArgumentException(std::string(name, nameSize).c_str(), "bad number of argument");
+                    }
+                    for (std::size_t i = 0 ; i < values.size() ; ++i) {
+                        pushValue(context, argument, values[i].data(), values[i].length());
+                    }
+                } while (reader.take(','));
+                reader.expect('}');
+            }
+            else {
+                reader.skipValue();
+            }
+        } while (reader.take(','));
+        reader.expect('}');
+    }
+    if (!reader.isEnd()) {
+        throw Exception("invalid serialized result");
+    }
+}
+
+/**
+ * @brief Copy a string in the block of snapshot
+ *
+ * @param block
+ * @param position position of next string in block
+ * @param data
+ * @param size
+ * @return Argparsor::Snapshot::String location of string
+ */
+static inline Argparsor::Snapshot::String writeSnapshotString(char* block, std::size_t* position, const char* data,
+                                                              std::size_t size) {
+    Argparsor::Snapshot::String ret;
+    ret.offset = *position;
+    ret.size = size;
+    if (size > 0) {
+        ::memcpy(block + *position, data, size);
+    }
+    *position += size;
+    return ret;
+}
+
+void Argparsor::snapshotState(const std::string& binaryName, const ParsedArgument* states,
+                              const std::vector<std::string>& additionalArguments, Snapshot* snapshot) const {
+    typedef Snapshot::String String;
+    std::list<Argument>::const_iterator it;
+    // size of parts of block
+    std::size_t nbName = 0;
+    std::size_t nbValue = 0;
+    std::size_t stringSize = binaryName.size();
+    for (it = _arguments.begin() ; it != _arguments.end() ; ++it) {
+        const ParsedArgument& argument = (states == NULL) ? *it : states[it->_index];
+        for (std::size_t i = 0 ; i < it->names.size() ; ++i) {
+            stringSize += it->names[i].size();
+        }
+        nbName += it->names.size();
+        nbValue += argument._valueCount;
+        for (const Value* value = argument.begin() ; value != argument.end() ; ++value) {
+            stringSize += value->length();
+        }
+    }
+    for (std::size_t i = 0 ; i < additionalArguments.size() ; ++i) {
+        stringSize += additionalArguments[i].size();
+    }
+    std::size_t nbSlot = 1;
+    while (nbSlot < nbName * 2) {
+        nbSlot *= 2;
+    }
+    Snapshot::Header header;
+    header.nbRecord = _arguments.size();
+    header.records = sizeof(Snapshot::Header);
+    header.nbSlot = nbSlot;
+    header.slots = header.records + header.nbRecord * sizeof(Snapshot::Record);
+    header.nbAdditionalArgument = additionalArguments.size();
+    header.additionalArguments = header.slots + nbSlot * sizeof(Snapshot::Slot);
+    std::size_t values = header.additionalArguments + header.nbAdditionalArgument * sizeof(String);
+    std::size_t position = values + nbValue * sizeof(String);
+    std::size_t size = position + stringSize;
+    // shared by the processes forked after
+    void* map = ::mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (map == MAP_FAILED) {
+        throw Exception("cannot map snapshot");
+    }
+    char* block = static_cast<char*>(map);
+    Snapshot::Record* records = reinterpret_cast<Snapshot::Record*>(block + header.records);
+    Snapshot::Slot* slots = reinterpret_cast<Snapshot::Slot*>(block + header.slots);
+    String* strings = reinterpret_cast<String*>(block + header.additionalArguments);
+    // empty slots
+    ::memset(slots, 0, nbSlot * sizeof(Snapshot::Slot));
+    header.binaryName = writeSnapshotString(block, &position, binaryName.c_str(), binaryName.size());
+    for (std::size_t i = 0 ; i < additionalArguments.size() ; ++i) {
+        strings[i] = writeSnapshotString(block, &position, additionalArguments[i].c_str(),
+                                         additionalArguments[i].size());
+    }
+    std::size_t index = 0;
+    for (it = _arguments.begin() ; it != _arguments.end() ; ++it, ++index) {
+        const ParsedArgument& argument = (states == NULL) ? *it : states[it->_index];
+        Snapshot::Record& record = records[index];
+        for (std::size_t i = 0 ; i < it->names.size() ; ++i) {
+            const std::string& name = it->names[i];
+            std::size_t slot = hashFlag(name.c_str(), name.size()) & (nbSlot - 1);
+            while (slots[slot].index != 0) {
+                slot = (slot + 1) & (nbSlot - 1);
+            }
+            slots[slot].name = writeSnapshotString(block, &position, name.c_str(), name.size());
+            slots[slot].index = index + 1;
+            if (i == 0) {
+                record.name = slots[slot].name;
+            }
+        }
+        record.type = argument._type;
+        record.isExist = argument._isExist;
+        record.count = argument._count;
+        record.nbArgs = argument._nbArgs;
+        record.nbValue = argument._valueCount;
+        record.values = values;
+        String* recordValues = reinterpret_cast<String*>(block + values);
+        for (std::size_t i = 0 ; i < argument._valueCount ; ++i) {
+            const Value& value = argument.begin()[i];
+            recordValues[i] = writeSnapshotString(block, &position, value.data(), value.length());
+        }
+        values += argument._valueCount * sizeof(String);
+    }
+    ::memcpy(block, &header, sizeof(header));
+    // the workers can only read
+    ::mprotect(map, size, PROT_READ);
+    if (snapshot->_block != NULL) {
+        ::munmap(snapshot->_block, snapshot->_size);
+    }
+    snapshot->_block = block;
+    snapshot->_size = size;
 }
 
-} // namespace mblet
\ No newline at end of file
+} // namespace mblet
@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+
+#include "argparsor.h"
+
+static void pushAdditionalArgument(const char* argument, std::size_t size, void* data) {
+    static_cast<std::vector<std::string>*>(data)->push_back(std::string(argument, size));
+}
+
+GTEST_TEST(additionalArgumentCallback, parse) {
+    const char* argv[] = {
+        "binaryname",
+        "foo", "bar", "-b", "baz", "--", "-qux"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    std::vector<std::string> additionalArguments;
+    mblet::Argparsor argparsor;
+    argparsor.setAdditionalArgumentCallback(&pushAdditionalArgument, &additionalArguments);
+    argparsor.addArgument("-b", "store_true");
+    argparsor.addArgument("POSITIONAL");
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    EXPECT_EQ(argparsor["POSITIONAL"].str(), "foo");
+    EXPECT_TRUE(argparsor["-b"]);
+    EXPECT_EQ(argparsor.getAdditionalArguments().size(), 0);
+    ASSERT_EQ(additionalArguments.size(), 3);
+    EXPECT_EQ(additionalArguments[0], "bar");
+    EXPECT_EQ(additionalArguments[1], "baz");
+    EXPECT_EQ(additionalArguments[2], "-qux");
+    // same callback with the const parse
+    additionalArguments.clear();
+    mblet::Argparsor::Result result;
+    argparsor.parse(argc, const_cast<char**>(argv), &result);
+    EXPECT_EQ(result.getAdditionalArguments().size(), 0);
+    EXPECT_EQ(additionalArguments.size(), 3);
+    // disable the callback
+    additionalArguments.clear();
+    argparsor.setAdditionalArgumentCallback(NULL);
+    argparsor.parse(argc, const_cast<char**>(argv), &result);
+    EXPECT_EQ(result.getAdditionalArguments().size(), 3);
+    EXPECT_EQ(additionalArguments.size(), 0);
+}
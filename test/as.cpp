@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "argparsor.h"
+
+struct Checked {
+    double value;
+};
+
+static std::istream& operator>>(std::istream& is, Checked& checked) {
+    is >> checked.value;
+    if (checked.value == 777) {
+        throw std::runtime_error("unexpected value");
+    }
+    return is;
+}
+
+GTEST_TEST(as, vector) {
+    const char* argv[] = {
+        "binaryname",
+        "-i", "1", "0x10", "-3", "-m", "4", "-m=5", "-n", "1.5", "2e3", "42"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    for (int zeroCopy = 0 ; zeroCopy < 2 ; ++zeroCopy) {
+        mblet::Argparsor argparsor;
+        argparsor.setZeroCopy(zeroCopy);
+        argparsor.addArgument("-i", NULL, NULL, false, NULL, '+');
+        argparsor.addArgument("-m", "append", NULL, false, NULL, 1);
+        argparsor.addArgument("-n", NULL, NULL, false, NULL, 2);
+        argparsor.addArgument("POSITIONAL");
+        argparsor.parseArguments(argc, const_cast<char**>(argv));
+        std::vector<int> infinite = argparsor["-i"].as<std::vector<int> >();
+        ASSERT_EQ(infinite.size(), 3);
+        EXPECT_EQ(infinite[0], 1);
+        EXPECT_EQ(infinite[1], 16);
+        EXPECT_EQ(infinite[2], -3);
+        std::vector<unsigned long> multi;
+        argparsor["-m"].as(&multi);
+        ASSERT_EQ(multi.size(), 2);
+        EXPECT_EQ(multi[0], 4);
+        EXPECT_EQ(multi[1], 5);
+        std::vector<double> number = argparsor["-n"].as<std::vector<double> >();
+        ASSERT_EQ(number.size(), 2);
+        EXPECT_EQ(number[0], 1.5);
+        EXPECT_EQ(number[1], 2000.0);
+        EXPECT_EQ(argparsor["POSITIONAL"].as<int>(), 42);
+        EXPECT_EQ(argparsor["POSITIONAL"].as<double>(), 42.0);
+    }
+}
+
+GTEST_TEST(as, error) {
+    const char* argv[] = {
+        "binaryname",
+        "-i", "1", "2", "3a", "4b", "-s", "300"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-i", NULL, NULL, false, NULL, '+');
+    argparsor.addArgument("-s", NULL, NULL, false, NULL, 1);
+    argparsor.addArgument("-b", "store_true");
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    EXPECT_THROW({
+        try {
+            argparsor["-i"].as<std::vector<int> >();
+        }
+        catch (const mblet::Argparsor::ConvertArgumentException& e) {
+            EXPECT_EQ(e.index(), 2);
+            EXPECT_STREQ(e.argument(), "3a");
+            EXPECT_STREQ(e.what(), "can't convert '3a' with type 'number'");
+            throw;
+        }
+    }, mblet::Argparsor::ConvertArgumentException);
+    EXPECT_THROW({
+        try {
+            argparsor["-s"].as<unsigned char>();
+        }
+        catch (const mblet::Argparsor::ConvertArgumentException& e) {
+            EXPECT_EQ(e.index(), 0);
+            EXPECT_STREQ(e.argument(), "300");
+            throw;
+        }
+    }, mblet::Argparsor::ConvertArgumentException);
+    EXPECT_THROW(argparsor["-s"].as<std::vector<int> >(), mblet::Argparsor::Exception);
+    EXPECT_THROW(argparsor["-i"].as<int>(), mblet::Argparsor::Exception);
+    EXPECT_THROW(argparsor["-b"].as<int>(), mblet::Argparsor::Exception);
+}
+
+GTEST_TEST(as, parallel) {
+    std::vector<std::string> values;
+    for (std::size_t i = 0 ; i < 100000 ; ++i) {
+        std::ostringstream oss("");
+        switch (i % 4) {
+            case 0:
+                oss << i;
+                break;
+            case 1:
+                oss << "0x" << std::hex << i;
+                break;
+            case 2:
+                oss << "0" << std::oct << i;
+                break;
+            default:
+                oss << "-" << i;
+                break;
+        }
+        values.push_back(oss.str());
+    }
+    std::vector<char*> argv;
+    argv.push_back(const_cast<char*>("binaryname"));
+    argv.push_back(const_cast<char*>("--values"));
+    for (std::size_t i = 0 ; i < values.size() ; ++i) {
+        argv.push_back(const_cast<char*>(values[i].c_str()));
+    }
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("--values", "extend", NULL, false, NULL, '+');
+    argparsor.parseArguments(argv.size(), &argv[0]);
+    std::vector<long> expected = argparsor["--values"].as<std::vector<long> >();
+    std::vector<long> result;
+    argparsor["--values"].as(&result, 8);
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(result[99999], -99999);
+    // errors in many threads
+    values[12345] = "0b2";
+    values[77777] = "bad";
+    values[99999] = "0x";
+    for (std::size_t i = 0 ; i < values.size() ; ++i) {
+        argv[2 + i] = const_cast<char*>(values[i].c_str());
+    }
+    mblet::Argparsor::Result parseResult;
+    argparsor.parse(argv.size(), &argv[0], &parseResult);
+    for (std::size_t nbThread = 1 ; nbThread <= 16 ; ++nbThread) {
+        EXPECT_THROW({
+            try {
+                parseResult["--values"].as(&result, nbThread);
+            }
+            catch (const mblet::Argparsor::ConvertArgumentException& e) {
+                EXPECT_EQ(e.index(), 12345);
+                EXPECT_STREQ(e.argument(), "0b2");
+                EXPECT_STREQ(e.what(), "can't convert '0b2' with type 'binnary number'");
+                throw;
+            }
+        }, mblet::Argparsor::ConvertArgumentException);
+    }
+    // bits of vector are converted in one thread
+    std::vector<std::string> booleans(10000, "true");
+    booleans[42] = "false";
+    argv.resize(2);
+    for (std::size_t i = 0 ; i < booleans.size() ; ++i) {
+        argv.push_back(const_cast<char*>(booleans[i].c_str()));
+    }
+    argparsor.parse(argv.size(), &argv[0], &parseResult);
+    std::vector<bool> booleanResult;
+    parseResult["--values"].as(&booleanResult, 8);
+    ASSERT_EQ(booleanResult.size(), 10000);
+    EXPECT_FALSE(booleanResult[42]);
+    EXPECT_TRUE(booleanResult[9999]);
+}
+
+GTEST_TEST(as, parallel_exception) {
+    std::vector<std::string> values(20000, "1");
+    values[15000] = "777";
+    std::vector<char*> argv;
+    argv.push_back(const_cast<char*>("binaryname"));
+    argv.push_back(const_cast<char*>("--values"));
+    for (std::size_t i = 0 ; i < values.size() ; ++i) {
+        argv.push_back(const_cast<char*>(values[i].c_str()));
+    }
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("--values", "extend", NULL, false, NULL, '+');
+    argparsor.parseArguments(argv.size(), &argv[0]);
+    std::vector<Checked> result;
+    // exception of a thread is thrown in the calling thread
+    for (std::size_t nbThread = 2 ; nbThread <= 4 ; ++nbThread) {
+        EXPECT_THROW({
+            try {
+                argparsor["--values"].as(&result, nbThread);
+            }
+            catch (const mblet::Argparsor::Exception& e) {
+                EXPECT_STREQ(e.what(), "unexpected value");
+                throw;
+            }
+        }, mblet::Argparsor::Exception);
+    }
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include "argparsor.h"
+
+GTEST_TEST(get, cache) {
+    char threads[] = "8";
+    char ratio[] = "0.5";
+    char* argv[] = {
+        const_cast<char*>("binaryname"),
+        const_cast<char*>("--threads"), threads, ratio
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.setZeroCopy(true);
+    argparsor.addArgument("--threads", NULL, NULL, false, NULL, 1, 1, "1");
+    argparsor.addArgument("RATIO", "0.1");
+    EXPECT_EQ(argparsor["--threads"].get<int>(), 1);
+    argparsor.parseArguments(argc, argv);
+    EXPECT_EQ(argparsor["--threads"].get<int>(), 8);
+    EXPECT_EQ(argparsor["RATIO"].get<double>(), 0.5);
+    // values are views of argv, a modification is not seen by the cache
+    threads[0] = '4';
+    ratio[2] = '2';
+    EXPECT_EQ(argparsor["--threads"].get<int>(), 8);
+    EXPECT_EQ(argparsor["RATIO"].get<double>(), 0.5);
+    // other type is converted
+    EXPECT_EQ(argparsor["--threads"].get<long>(), 4);
+    EXPECT_EQ(argparsor["RATIO"].get<float>(), 0.2f);
+    // new parse invalidate the cache
+    argparsor.reset();
+    EXPECT_EQ(argparsor["--threads"].get<long>(), 1);
+    argparsor.parseArguments(argc, argv);
+    EXPECT_EQ(argparsor["--threads"].get<long>(), 4);
+    mblet::Argparsor::Result result;
+    argparsor.parse(argc, argv, &result);
+    EXPECT_EQ(result["--threads"].get<int>(), 4);
+    threads[0] = '2';
+    EXPECT_EQ(result["--threads"].get<int>(), 4);
+    argparsor.parse(argc, argv, &result);
+    EXPECT_EQ(result["--threads"].get<int>(), 2);
+}
+
+GTEST_TEST(get, error) {
+    const char* argv[] = {
+        "binaryname",
+        "--threads", "many"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("--threads", NULL, NULL, false, NULL, 1);
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    EXPECT_THROW(argparsor["--threads"].get<int>(), mblet::Argparsor::ConvertArgumentException);
+    // error is not cached
+    EXPECT_THROW(argparsor["--threads"].get<int>(), mblet::Argparsor::ConvertArgumentException);
+}
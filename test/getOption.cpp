@@ -14,4 +14,26 @@ GTEST_TEST(getOption, not_found) {
             throw;
         }
     }, mblet::Argparsor::ArgumentException);
-}
\ No newline at end of file
+}
+
+GTEST_TEST(getOption, many_options) {
+    mblet::Argparsor argparsor;
+    std::vector<std::string> names;
+    for (std::size_t i = 0 ; i < 1000 ; ++i) {
+        std::ostringstream oss("");
+        oss << "--option" << i;
+        names.push_back(oss.str());
+        argparsor.addArgument(names.back().c_str(), "store_true");
+    }
+    for (std::size_t i = 0 ; i < names.size() ; ++i) {
+        EXPECT_EQ(argparsor[names[i]].names[0], names[i]);
+    }
+    EXPECT_EQ(argparsor["-h"].names[0], "-h");
+    EXPECT_THROW(argparsor.getOption("--option1000"), mblet::Argparsor::AccessDeniedException);
+    // replace help option
+    argparsor.addArgument("-z", "help");
+    EXPECT_THROW(argparsor.getOption("-h"), mblet::Argparsor::AccessDeniedException);
+    EXPECT_THROW(argparsor.getOption("--help"), mblet::Argparsor::AccessDeniedException);
+    EXPECT_EQ(argparsor["-z"].names[0], "-z");
+    EXPECT_EQ(argparsor["--option999"].names[0], "--option999");
+}
@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include "argparsor.h"
+
+static std::string readPipe(int fd) {
+    std::string str;
+    char buffer[1024];
+    ssize_t ret;
+    while ((ret = ::read(fd, buffer, sizeof(buffer))) > 0) {
+        str.append(buffer, static_cast<std::size_t>(ret));
+    }
+    return str;
+}
+
+GTEST_TEST(output, fd) {
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-s", NULL, "help of simple", false, NULL, 1);
+    // larger than buffer of FdOutput
+    argparsor.setDescription(std::string(5000, 'd').c_str());
+    std::ostringstream oss("");
+    argparsor.getUsage(oss);
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    argparsor.getUsage(fds[1]);
+    ::close(fds[1]);
+    EXPECT_EQ(readPipe(fds[0]), oss.str());
+    ::close(fds[0]);
+}
+
+GTEST_TEST(output, writeError) {
+    mblet::Argparsor argparsor;
+    const char* argv[] = {
+        "binaryname", "--unknown"
+    };
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    try {
+        argparsor.parseArguments(2, const_cast<char**>(argv));
+    }
+    catch (const mblet::Argparsor::ParseArgumentException& e) {
+        argparsor.writeError(fds[1], e);
+    }
+    ::close(fds[1]);
+    EXPECT_EQ(readPipe(fds[0]), "binaryname: invalid option -- 'unknown'\n");
+    ::close(fds[0]);
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <pthread.h>
+
+#include "argparsor.h"
+
+GTEST_TEST(parse, result) {
+    const char* argv[] = {
+        "binaryname",
+        "-b", "-s", "foo", "-m", "0", "-m", "1", "-N", "2", "3", "bar", "additional"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-b", "store_true");
+    argparsor.addArgument("-s", NULL, NULL, false, NULL, 1, 1, "default");
+    argparsor.addArgument("-m", "append", NULL, false, NULL, 1, 1, "default");
+    argparsor.addArgument("-N", "append", NULL, false, NULL, 2);
+    argparsor.addArgument("-d", NULL, NULL, false, NULL, 1, 1, "default");
+    argparsor.addArgument("POSITIONAL");
+    mblet::Argparsor::Result result;
+    argparsor.parse(argc, const_cast<char**>(argv), &result);
+    EXPECT_EQ(result.getBynaryName(), "binaryname");
+    EXPECT_TRUE(result["-b"]);
+    EXPECT_EQ(result["-b"].count(), 1);
+    EXPECT_EQ(result["-s"].str(), "foo");
+    EXPECT_EQ(result["-m"].str(), "0, 1");
+    EXPECT_EQ(result["-N"].size(), 1);
+    EXPECT_EQ(result["-N"][0][1].str(), "3");
+    EXPECT_FALSE(result["-d"].isExist());
+    EXPECT_EQ(result["-d"].str(), "default");
+    EXPECT_EQ(result["POSITIONAL"].getArgument(), "bar");
+    ASSERT_EQ(result.getAdditionalArguments().size(), 1);
+    EXPECT_EQ(result.getAdditionalArguments()[0], "additional");
+    // the argparsor object is not modified
+    EXPECT_FALSE(argparsor["-b"].isExist());
+    EXPECT_EQ(argparsor["-s"].str(), "default");
+    EXPECT_EQ(argparsor.getAdditionalArguments().size(), 0);
+    // parse again in the same result
+    const char* argv2[] = {
+        "binaryname",
+        "-m", "2"
+    };
+    const int argc2 = sizeof(argv2) / sizeof(*argv2);
+    argparsor.parse(argc2, const_cast<char**>(argv2), &result);
+    EXPECT_FALSE(result["-b"]);
+    EXPECT_EQ(result["-s"].str(), "default");
+    EXPECT_EQ(result["-m"].str(), "2");
+    EXPECT_EQ(result.getAdditionalArguments().size(), 0);
+}
+
+GTEST_TEST(parse, not_parsed) {
+    mblet::Argparsor::Result result;
+    EXPECT_THROW({
+        try {
+            result.getOption("-h");
+        }
+        catch (const mblet::Argparsor::AccessDeniedException& e) {
+            EXPECT_STREQ(e.argument(), "-h");
+            EXPECT_STREQ(e.what(), "option not found");
+            throw;
+        }
+    }, mblet::Argparsor::ArgumentException);
+}
+
+struct ParseThread {
+    const mblet::Argparsor* argparsor;
+    std::size_t id;
+    std::size_t nbError;
+};
+
+static void* parseThread(void* data) {
+    ParseThread* parseThread = static_cast<ParseThread*>(data);
+    for (std::size_t i = 0 ; i < 1000 ; ++i) {
+        std::ostringstream value("");
+        value << parseThread->id << '.' << i;
+        std::string valueStr = value.str();
+        const char* argv[] = {
+            "binaryname",
+            "-v", "--value", valueStr.c_str(), valueStr.c_str()
+        };
+        const int argc = sizeof(argv) / sizeof(*argv);
+        mblet::Argparsor::Result result;
+        parseThread->argparsor->parse(argc, const_cast<char**>(argv), &result);
+        if (!result["-v"] || result["--value"].str() != valueStr || result["POSITIONAL"].str() != valueStr) {
+            ++parseThread->nbError;
+        }
+    }
+    return NULL;
+}
+
+GTEST_TEST(parse, help) {
+    const char* argv[] = {
+        "binaryname",
+        "-h"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("--required", NULL, NULL, true, NULL, 1);
+    mblet::Argparsor::Result result;
+    // help option not exit and has priority on the required arguments
+    argparsor.parse(argc, const_cast<char**>(argv), &result);
+    EXPECT_TRUE(result.isHelpRequested());
+    EXPECT_TRUE(result["-h"]);
+    EXPECT_THROW(argparsor.parse(1, const_cast<char**>(argv), &result),
+                 mblet::Argparsor::ParseArgumentRequiredException);
+    EXPECT_FALSE(result.isHelpRequested());
+}
+
+GTEST_TEST(parse, concurrent) {
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-v", "store_true");
+    argparsor.addArgument("--value", NULL, NULL, true, NULL, 1);
+    argparsor.addArgument("POSITIONAL");
+    pthread_t threads[8];
+    ParseThread parseThreads[8];
+    for (std::size_t i = 0 ; i < 8 ; ++i) {
+        parseThreads[i].argparsor = &argparsor;
+        parseThreads[i].id = i;
+        parseThreads[i].nbError = 0;
+        ASSERT_EQ(pthread_create(&threads[i], NULL, &parseThread, &parseThreads[i]), 0);
+    }
+    for (std::size_t i = 0 ; i < 8 ; ++i) {
+        pthread_join(threads[i], NULL);
+        EXPECT_EQ(parseThreads[i].nbError, 0);
+    }
+}
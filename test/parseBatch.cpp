@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+#include "argparsor.h"
+
+GTEST_TEST(parseBatch, lines) {
+    const char buffer[] =
+        "binaryname -b -s foo bar\n"
+        "binaryname -s 'foo bar' \"a \\\"b\\\"\" c\\ d\r\n"
+        "\n"
+        "binaryname -s\n"
+        "binaryname --unknown\n"
+        "binaryname -h";
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-b", "store_true");
+    argparsor.addArgument("-s", NULL, NULL, false, NULL, 1, 1, "default");
+    argparsor.addArgument("POSITIONAL");
+    mblet::Argparsor::Batch batch;
+    argparsor.parseBatch(buffer, sizeof(buffer) - 1, &batch);
+    ASSERT_EQ(batch.size(), 6);
+    EXPECT_EQ(batch.getError(0), static_cast<const void*>(NULL));
+    EXPECT_EQ(batch[0].getBynaryName(), "binaryname");
+    EXPECT_TRUE(batch[0]["-b"]);
+    EXPECT_EQ(batch[0]["-s"].str(), "foo");
+    EXPECT_EQ(batch[0]["POSITIONAL"].str(), "bar");
+    EXPECT_EQ(batch.getError(1), static_cast<const void*>(NULL));
+    EXPECT_FALSE(batch[1]["-b"]);
+    EXPECT_EQ(batch[1]["-s"].str(), "foo bar");
+    EXPECT_EQ(batch[1]["POSITIONAL"].str(), "a \"b\"");
+    ASSERT_EQ(batch[1].getAdditionalArguments().size(), 1);
+    EXPECT_EQ(batch[1].getAdditionalArguments()[0], "c d");
+    EXPECT_EQ(batch.getError(2), static_cast<const void*>(NULL));
+    EXPECT_EQ(batch[2].getBynaryName(), "");
+    EXPECT_EQ(batch[2]["-s"].str(), "default");
+    ASSERT_NE(batch.getError(3), static_cast<const void*>(NULL));
+    EXPECT_STREQ(batch.getError(3)->argument(), "s");
+    EXPECT_STREQ(batch.getError(3)->what(), "bad number of argument");
+    ASSERT_NE(batch.getError(4), static_cast<const void*>(NULL));
+    EXPECT_STREQ(batch.getError(4)->argument(), "unknown");
+    EXPECT_STREQ(batch.getError(4)->what(), "invalid option");
+    // help option not exit in batch
+    EXPECT_EQ(batch.getError(5), static_cast<const void*>(NULL));
+    EXPECT_TRUE(batch[5]["-h"]);
+    EXPECT_TRUE(batch[5].isHelpRequested());
+    EXPECT_THROW(batch.at(6), std::out_of_range);
+}
+
+GTEST_TEST(parseBatch, threads) {
+    std::ostringstream oss("");
+    for (std::size_t i = 0 ; i < 10000 ; ++i) {
+        if (i % 7 == 0) {
+            oss << "binaryname -v" << '\n';
+        }
+        else {
+            oss << "binaryname --value " << i << ' ' << i << '\n';
+        }
+    }
+    const std::string buffer = oss.str();
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-v", "store_true");
+    argparsor.addArgument("--value", NULL, NULL, true, NULL, 1);
+    argparsor.addArgument("POSITIONAL");
+    mblet::Argparsor::Batch batch;
+    argparsor.parseBatch(buffer.c_str(), buffer.size(), &batch, false, false, 8);
+    ASSERT_EQ(batch.size(), 10000);
+    for (std::size_t i = 0 ; i < batch.size() ; ++i) {
+        if (i % 7 == 0) {
+            ASSERT_NE(batch.getError(i), static_cast<const void*>(NULL));
+            EXPECT_TRUE(dynamic_cast<const mblet::Argparsor::ParseArgumentRequiredException*>(batch.getError(i)));
+            EXPECT_STREQ(batch.getError(i)->argument(), "--value");
+        }
+        else {
+            std::ostringstream value("");
+            value << i;
+            ASSERT_EQ(batch.getError(i), static_cast<const void*>(NULL));
+            EXPECT_EQ(batch[i]["--value"].str(), value.str());
+            EXPECT_EQ(batch[i]["POSITIONAL"].str(), value.str());
+        }
+    }
+}
+
+GTEST_TEST(parseBatch, file) {
+    const char* filename = "/tmp/argparsor_parseBatch.txt";
+    FILE* file = ::fopen(filename, "w");
+    ASSERT_NE(file, static_cast<FILE*>(NULL));
+    ::fputs("binaryname foo\nbinaryname bar\n", file);
+    ::fclose(file);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("POSITIONAL");
+    mblet::Argparsor::Batch batch;
+    argparsor.parseBatchFile(filename, &batch);
+    ::remove(filename);
+    ASSERT_EQ(batch.size(), 2);
+    EXPECT_EQ(batch[0]["POSITIONAL"].str(), "foo");
+    EXPECT_EQ(batch[1]["POSITIONAL"].str(), "bar");
+    EXPECT_THROW({
+        try {
+            argparsor.parseBatchFile(filename, &batch);
+        }
+        catch (const mblet::Argparsor::ParseArgumentException& e) {
+            EXPECT_STREQ(e.argument(), filename);
+            EXPECT_STREQ(e.what(), "cannot open file");
+            throw;
+        }
+    }, mblet::Argparsor::ParseArgumentException);
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "argparsor.h"
+
+GTEST_TEST(parseConfigFile, precedence) {
+    const char* filename = "/tmp/argparsor_parseConfigFile.ini";
+    FILE* file = ::fopen(filename, "w");
+    ASSERT_NE(file, static_cast<FILE*>(NULL));
+    ::fputs("# comment\n"
+            "; comment\n"
+            "boolean\n"
+            "simple = foo bar\r\n"
+            "argv = file\n"
+            "environment = file\n"
+            "number = 1 '2 3'\n"
+            "multi = a b\n"
+            "multi = c\n"
+            "extend = d e\n"
+            "multi-number = 0 1 2 3\n"
+            "\n"
+            "[server]\n"
+            "port=8080", file);
+    ::fclose(file);
+    ::setenv("ARGPARSOR_TEST_ENVIRONMENT", "environment", 1);
+    const char* argv[] = {
+        "binaryname",
+        "--argv", "argv"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("--boolean", "store_true");
+    argparsor.addArgument("--simple", NULL, NULL, false, NULL, 1);
+    argparsor.addArgument("--argv", NULL, NULL, false, NULL, 1);
+    argparsor.addArgument("--environment", NULL, NULL, false, NULL, 1);
+    argparsor.addArgument("--number", NULL, NULL, false, NULL, 2);
+    argparsor.addArgument("--multi", "append", NULL, false, NULL, 1);
+    argparsor.addArgument("--extend", "extend", NULL, false, NULL, '+');
+    argparsor.addArgument("--multi-number", "append", NULL, false, NULL, 2);
+    argparsor.addArgument("--server-port", NULL, NULL, false, NULL, 1);
+    argparsor.addArgument("--default", NULL, NULL, false, NULL, 1, 1, "default");
+    argparsor.setEnvironmentVariable("--environment", "ARGPARSOR_TEST_ENVIRONMENT");
+    argparsor.setConfigFile(filename);
+    mblet::Argparsor::Result result;
+    argparsor.parse(argc, const_cast<char**>(argv), &result);
+    ::unsetenv("ARGPARSOR_TEST_ENVIRONMENT");
+    EXPECT_TRUE(result["--boolean"]);
+    EXPECT_EQ(result["--simple"].str(), "foo bar");
+    EXPECT_EQ(result["--argv"].str(), "argv");
+    EXPECT_EQ(result["--environment"].str(), "environment");
+    EXPECT_EQ(result["--number"].str(), "1, 2 3");
+    EXPECT_EQ(result["--multi"].str(), "a, b, c");
+    EXPECT_EQ(result["--extend"].str(), "d, e");
+    EXPECT_EQ(result["--multi-number"].str(), "(0, 1), (2, 3)");
+    EXPECT_EQ(result["--server-port"].as<int>(), 8080);
+    EXPECT_FALSE(result["--default"].isExist());
+    EXPECT_EQ(result["--default"].str(), "default");
+    // values of file are kept after the remove of file
+    argparsor.setZeroCopy(true);
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    ::remove(filename);
+    EXPECT_EQ(argparsor["--simple"].str(), "foo bar");
+    EXPECT_EQ(argparsor["--environment"].str(), "file");
+}
+
+GTEST_TEST(parseConfigFile, error) {
+    const char* filename = "/tmp/argparsor_parseConfigFile_error.ini";
+    const char* argv[] = {
+        "binaryname"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("--number", NULL, NULL, false, NULL, 2);
+    argparsor.setConfigFile(filename);
+    mblet::Argparsor::Result result;
+    EXPECT_THROW({
+        try {
+            argparsor.parse(argc, const_cast<char**>(argv), &result);
+        }
+        catch (const mblet::Argparsor::ParseArgumentException& e) {
+            EXPECT_STREQ(e.argument(), filename);
+            EXPECT_STREQ(e.what(), "cannot open file");
+            throw;
+        }
+    }, mblet::Argparsor::ParseArgumentException);
+    FILE* file = ::fopen(filename, "w");
+    ASSERT_NE(file, static_cast<FILE*>(NULL));
+    ::fputs("unknown = 42\n", file);
+    ::fclose(file);
+    EXPECT_THROW({
+        try {
+            argparsor.parse(argc, const_cast<char**>(argv), &result);
+        }
+        catch (const mblet::Argparsor::ParseArgumentException& e) {
+            EXPECT_STREQ(e.argument(), "unknown");
+            EXPECT_STREQ(e.what(), "invalid option");
+            throw;
+        }
+    }, mblet::Argparsor::ParseArgumentException);
+    file = ::fopen(filename, "w");
+    ASSERT_NE(file, static_cast<FILE*>(NULL));
+    ::fputs("number = 42\n", file);
+    ::fclose(file);
+    EXPECT_THROW({
+        try {
+            argparsor.parse(argc, const_cast<char**>(argv), &result);
+        }
+        catch (const mblet::Argparsor::ParseArgumentException& e) {
+            EXPECT_STREQ(e.argument(), "number");
+            EXPECT_STREQ(e.what(), "bad number of argument");
+            throw;
+        }
+    }, mblet::Argparsor::ParseArgumentException);
+    ::remove(filename);
+}
+
+GTEST_TEST(parseConfigFile, environment_false) {
+    const char* filename = "/tmp/argparsor_parseConfigFile_environment_false.ini";
+    FILE* file = ::fopen(filename, "w");
+    ASSERT_NE(file, static_cast<FILE*>(NULL));
+    ::fputs("verbose = true\n"
+            "quiet = true\n", file);
+    ::fclose(file);
+    ::setenv("ARGPARSOR_TEST_VERBOSE", "false", 1);
+    const char* argv[] = {
+        "binaryname"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("--verbose", "store_true");
+    argparsor.addArgument("--quiet", "store_true");
+    argparsor.setEnvironmentVariable("--verbose", "ARGPARSOR_TEST_VERBOSE");
+    argparsor.setConfigFile(filename);
+    mblet::Argparsor::Result result;
+    argparsor.parse(argc, const_cast<char**>(argv), &result);
+    // false value of environment has priority on the file
+    EXPECT_FALSE(result["--verbose"]);
+    EXPECT_EQ(result["--verbose"].count(), 0);
+    EXPECT_TRUE(result["--quiet"]);
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    ::unsetenv("ARGPARSOR_TEST_VERBOSE");
+    ::remove(filename);
+    EXPECT_FALSE(argparsor["--verbose"]);
+    EXPECT_TRUE(argparsor["--quiet"]);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+
+#include "argparsor.h"
+
+GTEST_TEST(parseEnvironment, fallback) {
+    ::setenv("ARGPARSOR_TEST_BOOLEAN", "yes", 1);
+    ::setenv("ARGPARSOR_TEST_ARGV", "env", 1);
+    ::setenv("ARGPARSOR_TEST_SIMPLE", "foo bar", 1);
+    ::setenv("ARGPARSOR_TEST_NUMBER", "1 '2 3'", 1);
+    ::setenv("ARGPARSOR_TEST_MULTI", "a b c", 1);
+    ::setenv("ARGPARSOR_TEST_MULTI_NUMBER", "0 1 2 3", 1);
+    ::setenv("ARGPARSOR_TEST_POSITIONAL", "positional", 1);
+    ::unsetenv("ARGPARSOR_TEST_DEFAULT");
+    const char* argv[] = {
+        "binaryname",
+        "-s", "argv"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-b", "store_true");
+    argparsor.addArgument("-s", NULL, NULL, false, NULL, 1, 1, "default");
+    argparsor.addArgument("--simple", NULL, NULL, false, NULL, 1);
+    argparsor.addArgument("-n", NULL, NULL, false, NULL, 2);
+    argparsor.addArgument("-m", "append", NULL, false, NULL, 1);
+    argparsor.addArgument("-N", "append", NULL, false, NULL, 2);
+    argparsor.addArgument("-d", NULL, NULL, false, NULL, 1, 1, "default");
+    argparsor.addArgument("POSITIONAL");
+    argparsor.setEnvironmentVariable("-b", "ARGPARSOR_TEST_BOOLEAN");
+    argparsor.setEnvironmentVariable("-s", "ARGPARSOR_TEST_ARGV");
+    argparsor.setEnvironmentVariable("--simple", "ARGPARSOR_TEST_SIMPLE");
+    argparsor.setEnvironmentVariable("--simple", "ARGPARSOR_TEST_SIMPLE");
+    argparsor.setEnvironmentVariable("-n", "ARGPARSOR_TEST_NUMBER");
+    argparsor.setEnvironmentVariable("-m", "ARGPARSOR_TEST_MULTI");
+    argparsor.setEnvironmentVariable("-N", "ARGPARSOR_TEST_MULTI_NUMBER");
+    argparsor.setEnvironmentVariable("-d", "ARGPARSOR_TEST_DEFAULT");
+    argparsor.setEnvironmentVariable("POSITIONAL", "ARGPARSOR_TEST_POSITIONAL");
+    EXPECT_EQ(argparsor["-d"].getEnvironmentVariable(), "ARGPARSOR_TEST_DEFAULT");
+    mblet::Argparsor::Result result;
+    argparsor.parse(argc, const_cast<char**>(argv), &result);
+    EXPECT_TRUE(result["-b"]);
+    // argv has priority
+    EXPECT_EQ(result["-s"].str(), "argv");
+    EXPECT_EQ(result["--simple"].str(), "foo bar");
+    EXPECT_EQ(result["-n"].str(), "1, 2 3");
+    EXPECT_EQ(result["-m"].str(), "a, b, c");
+    EXPECT_EQ(result["-N"].str(), "(0, 1), (2, 3)");
+    EXPECT_FALSE(result["-d"].isExist());
+    EXPECT_EQ(result["-d"].str(), "default");
+    EXPECT_EQ(result["POSITIONAL"].str(), "positional");
+    ::setenv("ARGPARSOR_TEST_BOOLEAN", "false", 1);
+    argparsor.setEnvironmentVariable("-s", "");
+    argparsor.parse(1, const_cast<char**>(argv), &result);
+    EXPECT_FALSE(result["-b"]);
+    EXPECT_EQ(result["-s"].str(), "default");
+    ::unsetenv("ARGPARSOR_TEST_BOOLEAN");
+    ::unsetenv("ARGPARSOR_TEST_ARGV");
+    ::unsetenv("ARGPARSOR_TEST_SIMPLE");
+    ::unsetenv("ARGPARSOR_TEST_NUMBER");
+    ::unsetenv("ARGPARSOR_TEST_MULTI");
+    ::unsetenv("ARGPARSOR_TEST_MULTI_NUMBER");
+    ::unsetenv("ARGPARSOR_TEST_POSITIONAL");
+}
+
+GTEST_TEST(parseEnvironment, error) {
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-b", "store_true");
+    argparsor.addArgument("-n", NULL, NULL, false, NULL, 2);
+    argparsor.setEnvironmentVariable("-b", "ARGPARSOR_TEST_BOOLEAN");
+    argparsor.setEnvironmentVariable("-n", "ARGPARSOR_TEST_NUMBER");
+    EXPECT_THROW({
+        try {
+            argparsor.setEnvironmentVariable("-n", "ARGPARSOR_TEST_BOOLEAN");
+        }
+        catch (const mblet::Argparsor::ArgumentException& e) {
+            EXPECT_STREQ(e.argument(), "ARGPARSOR_TEST_BOOLEAN");
+            EXPECT_STREQ(e.what(), "environment variable already used");
+            throw;
+        }
+    }, mblet::Argparsor::ArgumentException);
+    EXPECT_THROW({
+        try {
+            argparsor.setEnvironmentVariable("--unknown", "ARGPARSOR_TEST_UNKNOWN");
+        }
+        catch (const mblet::Argparsor::ArgumentException& e) {
+            EXPECT_STREQ(e.argument(), "--unknown");
+            EXPECT_STREQ(e.what(), "argument not found");
+            throw;
+        }
+    }, mblet::Argparsor::ArgumentException);
+    const char* argv[] = {
+        "binaryname"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor::Result result;
+    ::setenv("ARGPARSOR_TEST_BOOLEAN", "maybe", 1);
+    EXPECT_THROW({
+        try {
+            argparsor.parse(argc, const_cast<char**>(argv), &result);
+        }
+        catch (const mblet::Argparsor::ParseArgumentException& e) {
+            EXPECT_STREQ(e.argument(), "ARGPARSOR_TEST_BOOLEAN");
+            EXPECT_STREQ(e.what(), "invalid boolean value");
+            throw;
+        }
+    }, mblet::Argparsor::ParseArgumentException);
+    ::unsetenv("ARGPARSOR_TEST_BOOLEAN");
+    ::setenv("ARGPARSOR_TEST_NUMBER", "1 2 3", 1);
+    EXPECT_THROW({
+        try {
+            argparsor.parse(argc, const_cast<char**>(argv), &result);
+        }
+        catch (const mblet::Argparsor::ParseArgumentException& e) {
+            EXPECT_STREQ(e.argument(), "ARGPARSOR_TEST_NUMBER");
+            EXPECT_STREQ(e.what(), "bad number of argument");
+            throw;
+        }
+    }, mblet::Argparsor::ParseArgumentException);
+    ::unsetenv("ARGPARSOR_TEST_NUMBER");
+}
@@ -0,0 +1,23 @@
+#include <gtest/gtest.h>
+
+#include "argparsor.h"
+
+GTEST_TEST(positional, order) {
+    const char* argv[] = {
+        "binaryname",
+        "0", "1", "2", "3", "4"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("ZZZ");
+    argparsor.addArgument("AAA");
+    // usage sort the arguments but not the positional order
+    std::ostringstream oss;
+    argparsor.getUsage(oss);
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    EXPECT_EQ(argparsor["ZZZ"].str(), "0");
+    EXPECT_EQ(argparsor["AAA"].str(), "1");
+    ASSERT_EQ(argparsor.getAdditionalArguments().size(), 3);
+    EXPECT_EQ(argparsor.getAdditionalArguments()[0], "2");
+    EXPECT_EQ(argparsor.getAdditionalArguments()[2], "4");
+}
@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include "argparsor.h"
+
+GTEST_TEST(reset, parseArguments) {
+    const char* argv1[] = {
+        "binaryname",
+        "-b", "-s", "foo", "-m", "0", "-m", "1", "bar", "additional"
+    };
+    const int argc1 = sizeof(argv1) / sizeof(*argv1);
+    const char* argv2[] = {
+        "binaryname",
+        "-m", "2"
+    };
+    const int argc2 = sizeof(argv2) / sizeof(*argv2);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-b", "store_true");
+    argparsor.addArgument("-s", NULL, NULL, false, NULL, 1, 1, "default");
+    argparsor.addArgument("-m", "append", NULL, false, NULL, 1, 1, "default");
+    argparsor.addArgument("POSITIONAL");
+    argparsor.parseArguments(argc1, const_cast<char**>(argv1));
+    EXPECT_EQ(argparsor["-b"].count(), 1);
+    EXPECT_EQ(argparsor["-s"].str(), "foo");
+    EXPECT_EQ(argparsor["-m"].str(), "0, 1");
+    EXPECT_EQ(argparsor["POSITIONAL"].str(), "bar");
+    EXPECT_EQ(argparsor.getAdditionalArguments().size(), 1);
+    argparsor.reset();
+    EXPECT_FALSE(argparsor["-b"].isExist());
+    EXPECT_EQ(argparsor["-b"].count(), 0);
+    EXPECT_FALSE(argparsor["-s"].isExist());
+    EXPECT_EQ(argparsor["-s"].str(), "default");
+    EXPECT_EQ(argparsor["-m"].str(), "default");
+    EXPECT_FALSE(argparsor["POSITIONAL"].isExist());
+    EXPECT_EQ(argparsor["POSITIONAL"].str(), "");
+    EXPECT_EQ(argparsor.getAdditionalArguments().size(), 0);
+    argparsor.parseArguments(argc2, const_cast<char**>(argv2));
+    EXPECT_FALSE(argparsor["-b"].isExist());
+    EXPECT_EQ(argparsor["-s"].str(), "default");
+    EXPECT_EQ(argparsor["-m"].str(), "2");
+    EXPECT_EQ(argparsor["-m"].count(), 1);
+}
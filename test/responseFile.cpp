@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include <unistd.h>
+
+#include "argparsor.h"
+
+static void writeFile(const char* filename, const char* content) {
+    std::ofstream file(filename);
+    file << content;
+}
+
+GTEST_TEST(responseFile, parse) {
+    writeFile("/tmp/argparsor_response1.txt", "-s 'foo bar'\n--infinite a \"b \\\"c\\\"\" @/tmp/argparsor_response2.txt\n");
+    writeFile("/tmp/argparsor_response2.txt", "d\\ e\n\n-b positional\n");
+    const char* argv[] = {
+        "binaryname",
+        "@/tmp/argparsor_response1.txt", "-i", "f", "--", "@additional"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    for (int zeroCopy = 0 ; zeroCopy < 2 ; ++zeroCopy) {
+        mblet::Argparsor argparsor;
+        argparsor.setZeroCopy(zeroCopy);
+        argparsor.setFromFilePrefixChars("@");
+        argparsor.addArgument("-b", "store_true");
+        argparsor.addArgument("-s", NULL, NULL, false, NULL, 1);
+        argparsor.addArgument("-i --infinite", "extend", NULL, false, NULL, '+');
+        argparsor.addArgument("POSITIONAL");
+        argparsor.parseArguments(argc, const_cast<char**>(argv));
+        EXPECT_EQ(argparsor["-s"].str(), "foo bar");
+        EXPECT_EQ(argparsor["-i"].str(), "a, b \"c\", d e, f");
+        EXPECT_TRUE(argparsor["-b"]);
+        EXPECT_EQ(argparsor["POSITIONAL"].str(), "positional");
+        ASSERT_EQ(argparsor.getAdditionalArguments().size(), 1);
+        EXPECT_EQ(argparsor.getAdditionalArguments()[0], "@additional");
+    }
+    ::remove("/tmp/argparsor_response1.txt");
+    ::remove("/tmp/argparsor_response2.txt");
+}
+
+GTEST_TEST(responseFile, pipe) {
+    for (int zeroCopy = 0 ; zeroCopy < 2 ; ++zeroCopy) {
+        // like the process substitution of shell: prog @<(echo -v)
+        int fds[2];
+        ASSERT_EQ(::pipe(fds), 0);
+        ASSERT_EQ(::write(fds[1], "-v foo\n", 7), 7);
+        ::close(fds[1]);
+        char filename[32];
+        ::snprintf(filename, sizeof(filename), "@/dev/fd/%d", fds[0]);
+        const char* argv[] = {
+            "binaryname",
+            filename
+        };
+        const int argc = sizeof(argv) / sizeof(*argv);
+        mblet::Argparsor argparsor;
+        argparsor.setZeroCopy(zeroCopy);
+        argparsor.setFromFilePrefixChars("@");
+        argparsor.addArgument("-v", "store_true");
+        argparsor.addArgument("POSITIONAL");
+        argparsor.parseArguments(argc, const_cast<char**>(argv));
+        ::close(fds[0]);
+        EXPECT_TRUE(argparsor["-v"]);
+        EXPECT_EQ(argparsor["POSITIONAL"].str(), "foo");
+    }
+    // a directory cannot be read
+    const char* argv[] = {
+        "binaryname",
+        "@/tmp"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.setFromFilePrefixChars("@");
+    EXPECT_THROW({
+        try {
+            argparsor.parseArguments(argc, const_cast<char**>(argv));
+        }
+        catch (const mblet::Argparsor::ParseArgumentException& e) {
+            EXPECT_STREQ(e.argument(), "/tmp");
+            EXPECT_STREQ(e.what(), "cannot open file");
+            throw;
+        }
+    }, mblet::Argparsor::ParseArgumentException);
+}
+
+GTEST_TEST(responseFile, disabled) {
+    const char* argv[] = {
+        "binaryname",
+        "@/tmp/argparsor_not_found.txt"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("POSITIONAL");
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    EXPECT_EQ(argparsor["POSITIONAL"].str(), "@/tmp/argparsor_not_found.txt");
+}
+
+GTEST_TEST(responseFile, error) {
+    const char* argvNotFound[] = {
+        "binaryname",
+        "@/tmp/argparsor_not_found.txt"
+    };
+    const int argcNotFound = sizeof(argvNotFound) / sizeof(*argvNotFound);
+    mblet::Argparsor argparsor;
+    argparsor.setFromFilePrefixChars("@");
+    EXPECT_THROW({
+        try {
+            argparsor.parseArguments(argcNotFound, const_cast<char**>(argvNotFound));
+        }
+        catch (const mblet::Argparsor::ParseArgumentException& e) {
+            EXPECT_STREQ(e.argument(), "/tmp/argparsor_not_found.txt");
+            EXPECT_STREQ(e.what(), "cannot open file");
+            throw;
+        }
+    }, mblet::Argparsor::ParseArgumentException);
+    writeFile("/tmp/argparsor_recursive.txt", "@/tmp/argparsor_recursive.txt");
+    const char* argvRecursive[] = {
+        "binaryname",
+        "@/tmp/argparsor_recursive.txt"
+    };
+    const int argcRecursive = sizeof(argvRecursive) / sizeof(*argvRecursive);
+    EXPECT_THROW({
+        try {
+            argparsor.parseArguments(argcRecursive, const_cast<char**>(argvRecursive));
+        }
+        catch (const mblet::Argparsor::ParseArgumentException& e) {
+            EXPECT_STREQ(e.argument(), "/tmp/argparsor_recursive.txt");
+            EXPECT_STREQ(e.what(), "too many recursive response files");
+            throw;
+        }
+    }, mblet::Argparsor::ParseArgumentException);
+    ::remove("/tmp/argparsor_recursive.txt");
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include "argparsor.h"
+
+static void addArguments(mblet::Argparsor* argparsor) {
+    argparsor->addArgument("-b", "store_true");
+    argparsor->addArgument("-c", "store_false");
+    argparsor->addArgument("-s", NULL, NULL, false, NULL, 1, 1, "default");
+    argparsor->addArgument("-n", NULL, NULL, false, NULL, 2);
+    argparsor->addArgument("-i", NULL, NULL, false, NULL, '+');
+    argparsor->addArgument("-m", "append", NULL, false, NULL, 1);
+    argparsor->addArgument("-e", "extend", NULL, false, NULL, '+');
+    argparsor->addArgument("-N", "append", NULL, false, NULL, 2);
+    argparsor->addArgument("POSITIONAL");
+}
+
+static std::string serialize(const mblet::Argparsor& argparsor, const mblet::Argparsor::Result& result,
+                             mblet::Argparsor::Format format) {
+    std::string buffer(argparsor.serialize(result, NULL, 0, format), '\0');
+    argparsor.serialize(result, &buffer[0], buffer.size(), format);
+    return buffer;
+}
+
+GTEST_TEST(serialize, json) {
+    const char* argv[] = {
+        "binaryname",
+        "-b", "-s", "a \"quoted\"\n", "-N", "1", "2", "-N", "3", "4", "bar", "additional"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-b", "store_true");
+    argparsor.addArgument("-s", NULL, NULL, false, NULL, 1);
+    argparsor.addArgument("-N", "append", NULL, false, NULL, 2);
+    argparsor.addArgument("POSITIONAL");
+    mblet::Argparsor::Result result;
+    argparsor.parse(argc, const_cast<char**>(argv), &result);
+    const char expected[] =
+        "{\"binaryName\":\"binaryname\",\"arguments\":{"
+        "\"-h\":{\"type\":\"NONE\",\"isExist\":false,\"count\":0,\"values\":[]},"
+        "\"-b\":{\"type\":\"BOOLEAN_OPTION\",\"isExist\":true,\"count\":1,\"values\":[]},"
+        "\"-s\":{\"type\":\"SIMPLE_OPTION\",\"isExist\":true,\"count\":1,\"values\":[\"a \\\"quoted\\\"\\n\"]},"
+        "\"-N\":{\"type\":\"MULTI_NUMBER_OPTION\",\"isExist\":true,\"count\":2,\"values\":[[\"1\",\"2\"],[\"3\",\"4\"]]},"
+        "\"POSITIONAL\":{\"type\":\"POSITIONAL_ARGUMENT\",\"isExist\":true,\"count\":0,\"values\":[\"bar\"]}},"
+        "\"additionalArguments\":[\"additional\"]}";
+    EXPECT_EQ(serialize(argparsor, result, mblet::Argparsor::JSON_FORMAT), expected);
+    // nothing is written after size
+    char buffer[16];
+    ::memset(buffer, '.', sizeof(buffer));
+    EXPECT_EQ(argparsor.serialize(result, buffer, 8), sizeof(expected) - 1);
+    EXPECT_EQ(std::string(buffer, sizeof(buffer)), "{\"binary........");
+}
+
+GTEST_TEST(serialize, deserialize) {
+    const char* argv[] = {
+        "binaryname",
+        "-bc", "-i", "x", "y\t\x01", "-m", "0", "-m", "1", "-N", "1", "2", "-N", "3", "4", "-e", "e", "--",
+        "-n", "additional"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    addArguments(&argparsor);
+    mblet::Argparsor::Result result;
+    argparsor.parse(argc, const_cast<char**>(argv), &result);
+    const mblet::Argparsor::Format formats[] = {
+        mblet::Argparsor::JSON_FORMAT, mblet::Argparsor::BINARY_FORMAT
+    };
+    for (std::size_t i = 0 ; i < sizeof(formats) / sizeof(*formats) ; ++i) {
+        std::string buffer = serialize(argparsor, result, formats[i]);
+        mblet::Argparsor::Result copy;
+        argparsor.deserialize(buffer.c_str(), buffer.size(), &copy);
+        // buffer is not used by copy
+        buffer.assign(buffer.size(), '\0');
+        EXPECT_EQ(copy.getBynaryName(), "binaryname");
+        EXPECT_TRUE(copy["-b"]);
+        EXPECT_TRUE(copy["-c"].isExist());
+        EXPECT_FALSE(copy["-c"].boolean());
+        EXPECT_EQ(copy["-s"].str(), "default");
+        EXPECT_FALSE(copy["-s"]);
+        EXPECT_EQ(copy["-n"].size(), 0);
+        EXPECT_EQ(copy["-i"].str(), "x, y\t\x01");
+        EXPECT_EQ(copy["-m"].str(), "0, 1");
+        EXPECT_EQ(copy["-m"].count(), 2);
+        EXPECT_EQ(copy["-N"].size(), 2);
+        EXPECT_EQ(copy["-N"][1][0].str(), "3");
+        EXPECT_EQ(copy["-N"].str(), "(1, 2), (3, 4)");
+        EXPECT_EQ(copy["-e"].str(), "e");
+        EXPECT_EQ(copy["POSITIONAL"].str(), "-n");
+        ASSERT_EQ(copy.getAdditionalArguments().size(), 1);
+        EXPECT_EQ(copy.getAdditionalArguments()[0], "additional");
+        EXPECT_EQ(serialize(argparsor, copy, formats[i]), serialize(argparsor, result, formats[i]));
+    }
+}
+
+GTEST_TEST(serialize, argparsor) {
+    const char* argv[] = {
+        "binaryname",
+        "-s", "foo"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    addArguments(&argparsor);
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    std::string buffer(argparsor.serialize(NULL, 0, mblet::Argparsor::BINARY_FORMAT), '\0');
+    argparsor.serialize(&buffer[0], buffer.size(), mblet::Argparsor::BINARY_FORMAT);
+    mblet::Argparsor::Result result;
+    argparsor.deserialize(buffer.c_str(), buffer.size(), &result);
+    EXPECT_EQ(result["-s"].str(), "foo");
+    EXPECT_FALSE(result["-b"]);
+}
+
+GTEST_TEST(serialize, error) {
+    mblet::Argparsor argparsor;
+    addArguments(&argparsor);
+    mblet::Argparsor::Result result;
+    const char unknown[] = "{\"arguments\":{\"--unknown\":{\"type\":\"SIMPLE_OPTION\",\"values\":[\"a\"]}}}";
+    EXPECT_THROW({
+        try {
+            argparsor.deserialize(unknown, sizeof(unknown) - 1, &result);
+        }
+        catch (const mblet::Argparsor::ParseArgumentException& e) {
+            EXPECT_STREQ(e.argument(), "--unknown");
+            EXPECT_STREQ(e.what(), "invalid option");
+            throw;
+        }
+    }, mblet::Argparsor::ParseArgumentException);
+    const char type[] = "{\"arguments\":{\"-s\":{\"type\":\"BOOLEAN_OPTION\"}}}";
+    EXPECT_THROW({
+        try {
+            argparsor.deserialize(type, sizeof(type) - 1, &result);
+        }
+        catch (const mblet::Argparsor::ParseArgumentException& e) {
+            EXPECT_STREQ(e.argument(), "-s");
+            EXPECT_STREQ(e.what(), "invalid type of argument");
+            throw;
+        }
+    }, mblet::Argparsor::ParseArgumentException);
+    const char group[] = "{\"arguments\":{\"-N\":{\"type\":\"MULTI_NUMBER_OPTION\",\"values\":[[\"1\"]]}}}";
+    EXPECT_THROW(argparsor.deserialize(group, sizeof(group) - 1, &result), mblet::Argparsor::ParseArgumentException);
+    const char truncated[] = "{\"binaryName\":\"binaryname\"";
+    EXPECT_THROW(argparsor.deserialize(truncated, sizeof(truncated) - 1, &result), mblet::Argparsor::Exception);
+    const char* argv[] = {
+        "binaryname"
+    };
+    argparsor.parse(1, const_cast<char**>(argv), &result);
+    std::string binary = serialize(argparsor, result, mblet::Argparsor::BINARY_FORMAT);
+    EXPECT_THROW(argparsor.deserialize(binary.c_str(), binary.size() - 1, &result), mblet::Argparsor::Exception);
+    // unknown keys are ignored
+    const char ignored[] = " { \"version\" : [1, {\"a\": null}, -2.5e3, true] , \"binaryName\" : \"b\\u00e9\\/\" } ";
+    argparsor.deserialize(ignored, sizeof(ignored) - 1, &result);
+    EXPECT_EQ(result.getBynaryName(), "b\xc3\xa9/");
+    EXPECT_EQ(result["-s"].str(), "default");
+}
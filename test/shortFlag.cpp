@@ -0,0 +1,24 @@
+#include <gtest/gtest.h>
+
+#include "argparsor.h"
+
+GTEST_TEST(shortFlag, multi_boolean_option) {
+    const char* argv[] = {
+        "binaryname",
+        "-i", "0", "-abca", "-ba",
+        "-cbs", "foo"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-a", "store_true");
+    argparsor.addArgument("-b", "store_true");
+    argparsor.addArgument("-c", "store_false");
+    argparsor.addArgument("-s", NULL, NULL, false, NULL, 1);
+    argparsor.addArgument("-i", NULL, NULL, false, NULL, '+');
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    EXPECT_EQ(argparsor["-i"].size(), 1);
+    EXPECT_EQ(argparsor["-a"].count(), 3);
+    EXPECT_EQ(argparsor["-b"].count(), 3);
+    EXPECT_EQ(argparsor["-c"].count(), 2);
+    EXPECT_EQ(argparsor["-s"].getArgument(), "foo");
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "argparsor.h"
+
+GTEST_TEST(snapshot, accessors) {
+    const char* argv[] = {
+        "binaryname",
+        "-b", "--simple", "42", "-m", "0", "-m", "1", "-N", "1", "2", "-N", "3", "4", "bar", "additional"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-b", "store_true");
+    argparsor.addArgument("-c", "store_false");
+    argparsor.addArgument("-s --simple", NULL, NULL, false, NULL, 1, 1, "default");
+    argparsor.addArgument("-m", "append", NULL, false, NULL, 1);
+    argparsor.addArgument("-N", "append", NULL, false, NULL, 2);
+    argparsor.addArgument("-d", NULL, NULL, false, NULL, 1, 1, "default");
+    argparsor.addArgument("POSITIONAL");
+    mblet::Argparsor::Result result;
+    argparsor.parse(argc, const_cast<char**>(argv), &result);
+    mblet::Argparsor::Snapshot snapshot;
+    argparsor.snapshot(result, &snapshot);
+    EXPECT_EQ(snapshot.getBynaryName(), "binaryname");
+    EXPECT_TRUE(snapshot["-b"]);
+    EXPECT_TRUE(snapshot["-b"].boolean());
+    EXPECT_FALSE(snapshot["-c"].isExist());
+    EXPECT_EQ(snapshot["-c"].str(), "true");
+    EXPECT_EQ(snapshot["-s"].getArgument(), "42");
+    EXPECT_EQ(snapshot["--simple"].as<int>(), 42);
+    EXPECT_EQ(snapshot["-m"].str(), "0, 1");
+    EXPECT_EQ(snapshot["-m"].count(), 2);
+    EXPECT_EQ(snapshot["-N"].getType(), mblet::Argparsor::Argument::MULTI_NUMBER_OPTION);
+    EXPECT_EQ(snapshot["-N"].size(), 2);
+    EXPECT_EQ(snapshot["-N"][1][0].str(), "3");
+    EXPECT_EQ(snapshot["-N"].str(), "(1, 2), (3, 4)");
+    EXPECT_FALSE(snapshot["-d"]);
+    EXPECT_EQ(snapshot["-d"].str(), "default");
+    EXPECT_EQ(snapshot["POSITIONAL"].str(), "bar");
+    ASSERT_EQ(snapshot.getAdditionalArguments().size(), 1);
+    EXPECT_EQ(snapshot.getAdditionalArguments()[0], "additional");
+    EXPECT_THROW(snapshot["-N"].at(2), std::out_of_range);
+    EXPECT_THROW({
+        try {
+            snapshot["--unknown"];
+        }
+        catch (const mblet::Argparsor::AccessDeniedException& e) {
+            EXPECT_STREQ(e.argument(), "--unknown");
+            EXPECT_STREQ(e.what(), "option not found");
+            throw;
+        }
+    }, mblet::Argparsor::AccessDeniedException);
+}
+
+GTEST_TEST(snapshot, fork) {
+    const char* argv[] = {
+        "binaryname",
+        "--threads", "8"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("--threads", NULL, NULL, false, NULL, 1);
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    mblet::Argparsor::Snapshot snapshot;
+    argparsor.snapshot(&snapshot);
+    pid_t pid = ::fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+        // worker reads the block of parent
+        ::_exit((snapshot["--threads"].as<int>() == 8) ? 0 : 1);
+    }
+    int status = 0;
+    ASSERT_EQ(::waitpid(pid, &status, 0), pid);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include "argparsor.h"
+
+GTEST_TEST(str, write) {
+    const char* argv[] = {
+        "binaryname",
+        "-b", "-s", "foo", "-i", "1", "2", "-N", "3", "4", "-N", "5", "6", "-g", "7", "8"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-b", "store_true");
+    argparsor.addArgument("-c", "store_false");
+    argparsor.addArgument("-s", NULL, NULL, false, NULL, 1);
+    argparsor.addArgument("-i", NULL, NULL, false, NULL, '+');
+    argparsor.addArgument("-N", "append", NULL, false, NULL, 2);
+    argparsor.addArgument("-g", NULL, NULL, false, NULL, 2);
+    argparsor.addArgument("-e", NULL, NULL, false, NULL, '+');
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    const char* options[] = {
+        "-b", "-c", "-s", "-i", "-N", "-g", "-e"
+    };
+    const char* expected[] = {
+        "true", "true", "foo", "1, 2", "(3, 4), (5, 6)", "7, 8", ""
+    };
+    for (std::size_t i = 0 ; i < sizeof(options) / sizeof(*options) ; ++i) {
+        std::ostringstream oss("");
+        argparsor[options[i]].write(oss);
+        EXPECT_EQ(oss.str(), expected[i]) << options[i];
+        std::ostringstream ossOperator("");
+        ossOperator << argparsor[options[i]];
+        EXPECT_EQ(ossOperator.str(), expected[i]) << options[i];
+        EXPECT_EQ(argparsor[options[i]].str(), expected[i]) << options[i];
+    }
+    EXPECT_EQ(argparsor["-N"][1].str(), "5, 6");
+}
+
+GTEST_TEST(str, span) {
+    const char* argv[] = {
+        "binaryname",
+        "-i", "1", "22", "333", "-N", "3", "4", "-N", "5", "6"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.setZeroCopy(true);
+    argparsor.addArgument("-i", NULL, NULL, false, NULL, '+');
+    argparsor.addArgument("-N", "append", NULL, false, NULL, 2);
+    argparsor.addArgument("-e", NULL, NULL, false, NULL, '+');
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    const mblet::Argparsor::Argument& infinite = argparsor["-i"];
+    ASSERT_EQ(infinite.end() - infinite.begin(), 3);
+    EXPECT_EQ(infinite.begin()[1].data(), argv[3]);
+    EXPECT_EQ(infinite.begin()[2].length(), 3);
+    // groups values follow each other
+    const mblet::Argparsor::Argument& multiNumber = argparsor["-N"];
+    ASSERT_EQ(multiNumber.end() - multiNumber.begin(), 4);
+    EXPECT_EQ(multiNumber.begin()[3].getArgument(), "6");
+    mblet::Argparsor::Value group = multiNumber[1];
+    ASSERT_EQ(group.end() - group.begin(), 2);
+    EXPECT_EQ(group.begin()->getArgument(), "5");
+    EXPECT_EQ(argparsor["-e"].begin(), argparsor["-e"].end());
+}
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "strto.h"
+
+GTEST_TEST(strto, integer) {
+    EXPECT_EQ(mblet::strto<int>("42"), 42);
+    EXPECT_EQ(mblet::strto<int>("+42"), 42);
+    EXPECT_EQ(mblet::strto<int>("-42"), -42);
+    EXPECT_EQ(mblet::strto<int>("0"), 0);
+    EXPECT_EQ(mblet::strto<int>("0x2A"), 42);
+    EXPECT_EQ(mblet::strto<int>("-0x2a"), -42);
+    EXPECT_EQ(mblet::strto<int>("0b101010"), 42);
+    EXPECT_EQ(mblet::strto<int>("-0B101010"), -42);
+    EXPECT_EQ(mblet::strto<int>("052"), 42);
+    EXPECT_EQ(mblet::strto<int>("1e3"), 1000);
+    EXPECT_EQ(mblet::strto<int>("42.0"), 42);
+    EXPECT_EQ(mblet::strto<unsigned int>("-0"), 0u);
+    EXPECT_EQ(mblet::strto<long>("-9223372036854775808"), std::numeric_limits<long>::min());
+    EXPECT_EQ(mblet::strto<unsigned long>("0xFFFFFFFFFFFFFFFF"), std::numeric_limits<unsigned long>::max());
+    EXPECT_EQ(mblet::strto<signed char>("-128"), -128);
+    EXPECT_EQ(mblet::strto<unsigned short>("65535"), 65535);
+}
+
+GTEST_TEST(strto, integer_invalid) {
+    const char* invalids[] = {
+        "", "-", "0x", "0b", "0b102", "0xG", "08", "42a", " 42", "4 2", "42.5", "1e"
+    };
+    for (std::size_t i = 0 ; i < sizeof(invalids) / sizeof(*invalids) ; ++i) {
+        EXPECT_THROW(mblet::strto<int>(invalids[i]), mblet::StrToException) << invalids[i];
+    }
+    EXPECT_THROW({
+        try {
+            mblet::strto<int>("0b2");
+        }
+        catch (const mblet::StrToException& e) {
+            EXPECT_STREQ(e.value(), "0b2");
+            EXPECT_STREQ(e.type(), "binnary number");
+            EXPECT_STREQ(e.what(), "can't convert '0b2' with type 'binnary number'");
+            throw;
+        }
+    }, mblet::StrToException);
+}
+
+GTEST_TEST(strto, integer_overflow) {
+    const char* overflows[] = {
+        "128", "-129", "0x80", "-0x81", "0b10000000", "0200", "1e3", "-1e3"
+    };
+    for (std::size_t i = 0 ; i < sizeof(overflows) / sizeof(*overflows) ; ++i) {
+        EXPECT_THROW(mblet::strto<signed char>(overflows[i]), mblet::StrToOverflowException) << overflows[i];
+    }
+    EXPECT_THROW(mblet::strto<unsigned int>("-1"), mblet::StrToOverflowException);
+    EXPECT_THROW(mblet::strto<unsigned int>("4294967296"), mblet::StrToOverflowException);
+    EXPECT_THROW(mblet::strto<long>("9223372036854775808"), mblet::StrToOverflowException);
+    EXPECT_THROW(mblet::strto<long>("-9223372036854775809"), mblet::StrToOverflowException);
+    EXPECT_THROW(mblet::strto<unsigned long>("0x10000000000000000"), mblet::StrToOverflowException);
+    EXPECT_THROW(mblet::strto<long>("1e19"), mblet::StrToOverflowException);
+    EXPECT_THROW({
+        try {
+            mblet::strto<short>("0x8000");
+        }
+        catch (const mblet::StrToException& e) {
+            EXPECT_STREQ(e.what(), "can't convert '0x8000' with type 'hex number': out of range");
+            throw;
+        }
+    }, mblet::StrToOverflowException);
+}
+
+GTEST_TEST(strto, floating) {
+    EXPECT_EQ(mblet::strto<double>("42.5"), 42.5);
+    EXPECT_EQ(mblet::strto<double>("-1e3"), -1000.0);
+    EXPECT_EQ(mblet::strto<double>("0x10"), 16.0);
+    EXPECT_THROW(mblet::strto<double>("42.5a"), mblet::StrToException);
+}
+
+GTEST_TEST(strto, boolean) {
+    const char* trues[] = {
+        "TRUE", "True", "true", "ON", "On", "on", "YES", "Yes", "yes", "Y", "y", "1"
+    };
+    const char* falses[] = {
+        "FALSE", "False", "false", "OFF", "Off", "off", "NO", "No", "no", "N", "n", "0"
+    };
+    for (std::size_t i = 0 ; i < sizeof(trues) / sizeof(*trues) ; ++i) {
+        EXPECT_TRUE(mblet::strto<bool>(trues[i])) << trues[i];
+        EXPECT_FALSE(mblet::strto<bool>(falses[i])) << falses[i];
+    }
+    const char* invalids[] = {
+        "", "2", "tRUE", "TRue", "oN", "yES", "nO", "ofF", "fALSE", "truee", "tru", "yess", " on", "on "
+    };
+    for (std::size_t i = 0 ; i < sizeof(invalids) / sizeof(*invalids) ; ++i) {
+        EXPECT_THROW(mblet::strto<bool>(invalids[i]), mblet::StrToException) << invalids[i];
+    }
+    // buffer without null terminated
+    const char buffer[] = {'y', 'e', 's', 'n', 'o'};
+    EXPECT_TRUE(mblet::strto<bool>(buffer, 3));
+    EXPECT_FALSE(mblet::strto<bool>(buffer + 3, 2));
+    EXPECT_EQ(mblet::strto<int>("42" "43", 2), 42);
+    EXPECT_THROW({
+        try {
+            mblet::strto<bool>(buffer, 4);
+        }
+        catch (const mblet::StrToException& e) {
+            EXPECT_STREQ(e.what(), "can't convert 'yesn' with type 'bool'");
+            throw;
+        }
+    }, mblet::StrToException);
+}
+
+static std::string randomDecimal() {
+    std::string str;
+    if (std::rand() % 2) {
+        str += '-';
+    }
+    std::size_t nbDigits = 1 + std::rand() % 25;
+    std::size_t point = std::rand() % (nbDigits + 1);
+    for (std::size_t i = 0 ; i < nbDigits ; ++i) {
+        if (i == point) {
+            str += '.';
+        }
+        // first digit is not 0 for not be an octal number
+        str += static_cast<char>((i == 0) ? '1' + std::rand() % 9 : '0' + std::rand() % 10);
+    }
+    if (std::rand() % 2) {
+        char exponent[16];
+        ::snprintf(exponent, sizeof(exponent), "e%d", std::rand() % 80 - 40);
+        str += exponent;
+    }
+    return str;
+}
+
+GTEST_TEST(strto, floating_random) {
+    std::srand(42);
+    for (std::size_t i = 0 ; i < 100000 ; ++i) {
+        std::string str = randomDecimal();
+        double expected = ::strtod(str.c_str(), NULL);
+        double value = mblet::strto<double>(str);
+        ASSERT_EQ(std::memcmp(&value, &expected, sizeof(double)), 0) << str;
+        // rounded one time from the decimal
+        float expectedFloat = ::strtof(str.c_str(), NULL);
+        if (std::fabs(expectedFloat) <= std::numeric_limits<float>::max()) {
+            float valueFloat = mblet::strto<float>(str);
+            ASSERT_EQ(std::memcmp(&valueFloat, &expectedFloat, sizeof(float)), 0) << str;
+        }
+        else {
+            ASSERT_THROW(mblet::strto<float>(str), mblet::StrToOverflowException) << str;
+        }
+    }
+    // round trip of random doubles
+    for (std::size_t i = 0 ; i < 100000 ; ++i) {
+        double expected = (static_cast<double>(std::rand()) / RAND_MAX - 0.5) * std::pow(10.0, std::rand() % 600 - 300);
+        char buffer[32];
+        ::snprintf(buffer, sizeof(buffer), "%.17g", expected);
+        ASSERT_EQ(mblet::strto<double>(buffer), expected) << buffer;
+    }
+    // round trip of random floats
+    for (std::size_t i = 0 ; i < 100000 ; ++i) {
+        float expected = static_cast<float>((static_cast<double>(std::rand()) / RAND_MAX - 0.5) *
+                                            std::pow(10.0, std::rand() % 76 - 38));
+        char buffer[32];
+        ::snprintf(buffer, sizeof(buffer), "%.9g", expected);
+        ASSERT_EQ(mblet::strto<float>(buffer), expected) << buffer;
+    }
+    EXPECT_EQ(mblet::strto<float>("7.038531e-26"), ::strtof("7.038531e-26", NULL));
+    // shortest round trip of FLT_MAX
+    EXPECT_EQ(mblet::strto<float>("3.4028235e38"), std::numeric_limits<float>::max());
+    EXPECT_EQ(mblet::strto<float>("-3.4028235e38"), -std::numeric_limits<float>::max());
+    EXPECT_THROW(mblet::strto<float>("3.5e38"), mblet::StrToOverflowException);
+}
+
+GTEST_TEST(strto, floating_limits) {
+    EXPECT_EQ(mblet::strto<double>("0.1"), 0.1);
+    EXPECT_EQ(mblet::strto<double>("0.123456789012345678"), 0.123456789012345678);
+    EXPECT_EQ(mblet::strto<double>(".5"), 0.5);
+    EXPECT_EQ(mblet::strto<double>("5."), 5.0);
+    EXPECT_EQ(mblet::strto<double>("1000000000000000000000000"), 1e24);
+    EXPECT_EQ(mblet::strto<double>("1.7976931348623157e308"), 1.7976931348623157e308);
+    EXPECT_EQ(mblet::strto<double>("4.9406564584124654e-324"), 4.9406564584124654e-324);
+    EXPECT_EQ(mblet::strto<double>("1e-400"), 0.0);
+    EXPECT_EQ(mblet::strto<float>("3.4028234e38"), 3.4028234e38f);
+    EXPECT_TRUE(std::signbit(mblet::strto<double>("-0.0")));
+    EXPECT_EQ(mblet::strto<double>("010"), 8.0);
+    EXPECT_EQ(mblet::strto<double>("-0b11"), -3.0);
+    EXPECT_THROW(mblet::strto<double>("1e400"), mblet::StrToOverflowException);
+    EXPECT_THROW(mblet::strto<float>("1e39"), mblet::StrToOverflowException);
+    const char* invalids[] = {
+        "", "-", ".", "e5", "1e", "1e+", "1.2.3", "1e5.5", "inf", "nan", " 1.5", "1.5 ", "0x1.8p1"
+    };
+    for (std::size_t i = 0 ; i < sizeof(invalids) / sizeof(*invalids) ; ++i) {
+        EXPECT_THROW(mblet::strto<double>(invalids[i]), mblet::StrToException) << invalids[i];
+    }
+}
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include "argparsor.h"
+
+static void buildBuild(mblet::Argparsor& argparsor, void* data) {
+    ++*static_cast<int*>(data);
+    argparsor.addArgument("-j --jobs", NULL, NULL, false, NULL, 1, 1, "1");
+    argparsor.addArgument("TARGET");
+}
+
+static void buildTest(mblet::Argparsor& argparsor, void* data) {
+    ++*static_cast<int*>(data);
+    argparsor.addArgument("-v", "store_true");
+}
+
+GTEST_TEST(subcommand, parse) {
+    const char* argv[] = {
+        "binaryname",
+        "-v", "build", "-j", "4", "-v", "all"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    int nbBuild = 0;
+    int nbTest = 0;
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-v", "store_true");
+    argparsor.addSubcommand("build", &buildBuild, "build the targets", &nbBuild);
+    argparsor.addSubcommand("test", &buildTest, "run the tests", &nbTest);
+    mblet::Argparsor::Result result;
+    EXPECT_THROW({
+        try {
+            argparsor.parse(argc, const_cast<char**>(argv), &result);
+        }
+        catch (const mblet::Argparsor::ParseArgumentException& e) {
+            // "-v" after subcommand is an option of subcommand
+            EXPECT_STREQ(e.argument(), "v");
+            EXPECT_STREQ(e.what(), "invalid option");
+            throw;
+        }
+    }, mblet::Argparsor::ParseArgumentException);
+    const char* argv2[] = {
+        "binaryname",
+        "-v", "build", "-j", "4", "all"
+    };
+    const int argc2 = sizeof(argv2) / sizeof(*argv2);
+    argparsor.parse(argc2, const_cast<char**>(argv2), &result);
+    EXPECT_TRUE(result["-v"]);
+    EXPECT_EQ(result.getSubcommandName(), "build");
+    EXPECT_EQ(result.getSubcommand().getBynaryName(), "binaryname build");
+    EXPECT_EQ(result.getSubcommand()["--jobs"].as<int>(), 4);
+    EXPECT_EQ(result.getSubcommand()["TARGET"].str(), "all");
+    // only the schema of subcommand used is built one time
+    EXPECT_EQ(nbBuild, 1);
+    EXPECT_EQ(nbTest, 0);
+    // without subcommand
+    argparsor.parse(2, const_cast<char**>(argv2), &result);
+    EXPECT_EQ(result.getSubcommandName(), "");
+    EXPECT_THROW(result.getSubcommand(), mblet::Argparsor::AccessDeniedException);
+    // parse of argparsor object
+    const char* argv3[] = {
+        "binaryname",
+        "test", "-v"
+    };
+    const int argc3 = sizeof(argv3) / sizeof(*argv3);
+    argparsor.parseArguments(argc3, const_cast<char**>(argv3));
+    EXPECT_FALSE(argparsor["-v"]);
+    EXPECT_EQ(argparsor.getSubcommandName(), "test");
+    EXPECT_TRUE(argparsor.getSubcommand()["-v"]);
+    EXPECT_EQ(nbBuild, 1);
+    EXPECT_EQ(nbTest, 1);
+    argparsor.reset();
+    EXPECT_THROW(argparsor.getSubcommand(), mblet::Argparsor::AccessDeniedException);
+}
+
+GTEST_TEST(subcommand, positional) {
+    const char* argv[] = {
+        "binaryname",
+        "file.txt", "build", "all"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    int nbBuild = 0;
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("INPUT", NULL, NULL, true);
+    argparsor.addSubcommand("build", &buildBuild, "build the targets", &nbBuild);
+    mblet::Argparsor::Result result;
+    // positional arguments of parent are before the subcommand
+    argparsor.parse(argc, const_cast<char**>(argv), &result);
+    EXPECT_EQ(result["INPUT"].str(), "file.txt");
+    EXPECT_EQ(result.getSubcommandName(), "build");
+    EXPECT_EQ(result.getSubcommand()["TARGET"].str(), "all");
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    EXPECT_EQ(argparsor["INPUT"].str(), "file.txt");
+    EXPECT_EQ(argparsor.getSubcommandName(), "build");
+    // subcommand is optional
+    argparsor.parse(2, const_cast<char**>(argv), &result);
+    EXPECT_EQ(result["INPUT"].str(), "file.txt");
+    EXPECT_EQ(result.getSubcommandName(), "");
+    EXPECT_THROW(argparsor.parse(1, const_cast<char**>(argv), &result),
+                 mblet::Argparsor::ParseArgumentRequiredException);
+}
+
+GTEST_TEST(subcommand, error) {
+    int nbBuild = 0;
+    mblet::Argparsor argparsor;
+    argparsor.addSubcommand("build", &buildBuild, NULL, &nbBuild);
+    EXPECT_THROW({
+        try {
+            argparsor.addSubcommand("build", &buildBuild, NULL, &nbBuild);
+        }
+        catch (const mblet::Argparsor::ArgumentException& e) {
+            EXPECT_STREQ(e.argument(), "build");
+            EXPECT_STREQ(e.what(), "invalid subcommand already exist");
+            throw;
+        }
+    }, mblet::Argparsor::ArgumentException);
+    EXPECT_THROW(argparsor.addSubcommand("-build", &buildBuild), mblet::Argparsor::ArgumentException);
+    EXPECT_THROW(argparsor.addSubcommand("", &buildBuild), mblet::Argparsor::ArgumentException);
+    const char* argv[] = {
+        "binaryname",
+        "unknown"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor::Result result;
+    EXPECT_THROW({
+        try {
+            argparsor.parse(argc, const_cast<char**>(argv), &result);
+        }
+        catch (const mblet::Argparsor::ParseArgumentException& e) {
+            EXPECT_STREQ(e.argument(), "unknown");
+            EXPECT_STREQ(e.what(), "invalid subcommand");
+            throw;
+        }
+    }, mblet::Argparsor::ParseArgumentException);
+    EXPECT_EQ(nbBuild, 0);
+}
+
+GTEST_TEST(subcommand, usage) {
+    int nbBuild = 0;
+    int nbTest = 0;
+    mblet::Argparsor argparsor;
+    argparsor.addSubcommand("build", &buildBuild, "build the targets", &nbBuild);
+    argparsor.addSubcommand("test", &buildTest, "run the tests", &nbTest);
+    std::ostringstream oss("");
+    argparsor.getUsage(oss);
+    EXPECT_EQ(oss.str(),
+              "usage:  [-h] COMMAND ...\n"
+              "\n"
+              "commands:\n"
+              "  build       build the targets\n"
+              "  test        run the tests\n"
+              "\n"
+              "optional arguments:\n"
+              "  -h, --help  show this help message and exit\n");
+    EXPECT_EQ(nbBuild, 0);
+    EXPECT_EQ(nbTest, 0);
+}
@@ -0,0 +1,23 @@
+#include <gtest/gtest.h>
+
+#include "argparsor.h"
+
+GTEST_TEST(tokenStream, infinite_until_option) {
+    const char* argv[] = {
+        "binaryname",
+        "-i", "0", "-1", "--unknown", "-bz", "-bi", "1", "--infinite=2", "-b", "--", "-i", "3"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-b", "store_true");
+    argparsor.addArgument("-i --infinite", NULL, NULL, false, NULL, '+');
+    argparsor.addArgument("-e", "extend", NULL, false, NULL, '+');
+    argparsor.addArgument("POSITIONAL");
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    EXPECT_EQ(argparsor["-i"].str(), "2");
+    EXPECT_EQ(argparsor["-i"].count(), 3);
+    EXPECT_EQ(argparsor["-b"].count(), 2);
+    EXPECT_EQ(argparsor["POSITIONAL"].str(), "-i");
+    ASSERT_EQ(argparsor.getAdditionalArguments().size(), 1);
+    EXPECT_EQ(argparsor.getAdditionalArguments()[0], "3");
+}
@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+
+#include "argparsor.h"
+
+GTEST_TEST(usageCache, getUsage) {
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-s", NULL, "help of simple", false, NULL, 1);
+    std::ostringstream first("");
+    argparsor.getUsage(first);
+    EXPECT_EQ(first.str(), "usage:  [-h] [-s S]\n\noptional arguments:\n  -h, --help  show this help message and exit\n  -s S        help of simple\n");
+    std::ostringstream second("");
+    argparsor.getUsage(second);
+    EXPECT_EQ(second.str(), first.str());
+    // binary name of parse
+    const char* argv[] = {
+        "binaryname"
+    };
+    argparsor.parseArguments(1, const_cast<char**>(argv));
+    std::ostringstream binaryName("");
+    argparsor.getUsage(binaryName);
+    EXPECT_EQ(binaryName.str(), "usage: binaryname [-h] [-s S]\n\noptional arguments:\n  -h, --help  show this help message and exit\n  -s S        help of simple\n");
+    // modifications invalidate the cache
+    argparsor.addArgument("-b", "store_true", "help of boolean");
+    argparsor.setDescription("description");
+    argparsor.setEpilog("epilog");
+    std::ostringstream modified("");
+    argparsor.getUsage(modified);
+    EXPECT_EQ(modified.str(), "usage: binaryname [-b] [-h] [-s S]\n\ndescription\n\noptional arguments:\n  -b          help of boolean\n  -h, --help  show this help message and exit\n  -s S        help of simple\n\nepilog\n");
+    argparsor.setUsage("custom");
+    std::ostringstream custom("");
+    argparsor.getUsage(custom);
+    EXPECT_EQ(custom.str(), "custom");
+}
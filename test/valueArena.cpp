@@ -0,0 +1,23 @@
+#include <gtest/gtest.h>
+
+#include "argparsor.h"
+
+GTEST_TEST(valueArena, interleaved_values) {
+    const char* argv[] = {
+        "binaryname",
+        "-m", "0", "-N", "1", "2", "-s", "foo", "-m", "3", "-N", "4", "5", "-m=6"
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.addArgument("-m", "append", NULL, false, NULL, 1, 1, "default");
+    argparsor.addArgument("-N", "append", NULL, false, NULL, 2);
+    argparsor.addArgument("-s", NULL, NULL, false, NULL, 1, 1, "default");
+    argparsor.parseArguments(argc, const_cast<char**>(argv));
+    EXPECT_EQ(argparsor["-m"].size(), 3);
+    EXPECT_EQ(argparsor["-m"].str(), "0, 3, 6");
+    EXPECT_EQ(argparsor["-N"].size(), 2);
+    EXPECT_EQ(argparsor["-N"][1].size(), 2);
+    EXPECT_EQ(argparsor["-N"][1][0].str(), "4");
+    EXPECT_EQ(argparsor["-N"].str(), "(1, 2), (4, 5)");
+    EXPECT_EQ(argparsor["-s"].str(), "foo");
+}
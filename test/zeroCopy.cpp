@@ -0,0 +1,27 @@
+#include <gtest/gtest.h>
+
+#include "argparsor.h"
+
+GTEST_TEST(zeroCopy, parseArguments) {
+    char simple[] = "--simple=foo";
+    char number[] = "-n";
+    char first[] = "bar";
+    char second[] = "42";
+    char* argv[] = {
+        const_cast<char*>("binaryname"),
+        simple, number, first, second
+    };
+    const int argc = sizeof(argv) / sizeof(*argv);
+    mblet::Argparsor argparsor;
+    argparsor.setZeroCopy(true);
+    argparsor.addArgument("-s --simple", NULL, NULL, false, NULL, 1);
+    argparsor.addArgument("-n", NULL, NULL, false, NULL, 2);
+    argparsor.parseArguments(argc, argv);
+    EXPECT_EQ(argparsor["-s"].getArgument(), "foo");
+    EXPECT_EQ(argparsor["-n"].str(), "bar, 42");
+    // values are views of argv
+    first[0] = 'c';
+    simple[sizeof("--simple=") - 1] = 'g';
+    EXPECT_EQ(argparsor["-s"].getArgument(), "goo");
+    EXPECT_EQ(argparsor["-n"][0].getArgument(), "car");
+}